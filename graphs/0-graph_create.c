@@ -2,11 +2,15 @@
 #include "graphs.h"
 
 /**
- * graph_create - Allocates memory for a graph_t structure and initializes it
+ * graph_create_flags - Allocates memory for a graph_t structure and
+ * initializes it with the given flags
+ * @flags: Bitwise OR of GRAPH_* flags, e.g. GRAPH_ARENA to allocate vertices,
+ * edges and strings from slabs owned by the graph, or GRAPH_UNIQUE_EDGES to
+ * reject edges that already exist
  *
  * Return: Pointer to the newly allocated graph, or NULL on failure
  */
-graph_t *graph_create(void)
+graph_t *graph_create_flags(unsigned int flags)
 {
 	graph_t *graph;
 
@@ -16,6 +20,27 @@ graph_t *graph_create(void)
 
 	graph->nb_vertices = 0;
 	graph->vertices = NULL;
+	graph->tail = NULL;
+	graph->buckets = NULL;
+	graph->nb_buckets = 0;
+	graph->flags = flags;
+	graph->slabs = NULL;
+	graph->edge_buckets = NULL;
+	graph->nb_edge_buckets = 0;
+	graph->nb_indexed_edges = 0;
+	graph->nb_removed = 0;
+	graph->by_id = NULL;
+	graph->by_id_size = 0;
 
 	return (graph);
 }
+
+/**
+ * graph_create - Allocates memory for a graph_t structure and initializes it
+ *
+ * Return: Pointer to the newly allocated graph, or NULL on failure
+ */
+graph_t *graph_create(void)
+{
+	return (graph_create_flags(0));
+}
@@ -3,38 +3,37 @@
 #include "graphs.h"
 
 /**
- * graph_add_vertex - Adds a new vertex to the graph
+ * graph_add_vertex_len - Adds a new vertex to the graph, named after a
+ * string that is not necessarily NUL-terminated
+ * Empty names are rejected, snapshots and mapped files use them for the
+ * vertices that were removed
  *
  * @graph: Pointer to the graph to add the vertex to
- * @str: String to store in the new vertex
+ * @str: Bytes to store in the new vertex
+ * @len: Number of bytes in @str
  *
  * Return: Pointer to the created vertex, or NULL on failure
  */
-vertex_t *graph_add_vertex(graph_t *graph, const char *str)
+vertex_t *graph_add_vertex_len(graph_t *graph, const char *str, size_t len)
 {
-	vertex_t *new_vertex, *temp;
-	size_t index = 0;
+	vertex_t *new_vertex;
 
-	if (!graph || !str)
+	if (!graph || !str || !len)
 		return (NULL);
 
 	/* Check if vertex already exists */
-	for (temp = graph->vertices; temp; temp = temp->next)
-	{
-		if (strcmp(temp->content, str) == 0)
-			return (NULL);
-		index++;
-	}
+	if (graph_find_vertex_len(graph, str, len))
+		return (NULL);
 
 	/* Allocate and initialize new vertex */
-	new_vertex = malloc(sizeof(vertex_t));
+	new_vertex = graph_alloc(graph, sizeof(vertex_t));
 	if (!new_vertex)
 		return (NULL);
 
-	new_vertex->content = strdup(str);
+	new_vertex->content = graph_strndup(graph, str, len);
 	if (!new_vertex->content)
 	{
-		free(new_vertex);
+		graph_free_item(graph, new_vertex);
 		return (NULL);
 	}
 
@@ -43,18 +42,38 @@ vertex_t *graph_add_vertex(graph_t *graph, const char *str)
 	new_vertex->edges = NULL;
 	new_vertex->next = NULL;
 
+	if (!graph_by_id_reserve(graph) ||
+	    !graph_index_insert(graph, new_vertex))
+	{
+		graph_free_item(graph, new_vertex->content);
+		graph_free_item(graph, new_vertex);
+		return (NULL);
+	}
+
 	/* Add to adjacency list */
 	if (!graph->vertices)
 		graph->vertices = new_vertex;
 	else
-	{
-		temp = graph->vertices;
-		while (temp->next)
-			temp = temp->next;
-		temp->next = new_vertex;
-	}
+		graph->tail->next = new_vertex;
+	graph->tail = new_vertex;
 
-	graph->nb_vertices++;
+	graph->by_id[graph->nb_vertices++] = new_vertex;
 
 	return (new_vertex);
 }
+
+/**
+ * graph_add_vertex - Adds a new vertex to the graph, see
+ * graph_add_vertex_len
+ *
+ * @graph: Pointer to the graph to add the vertex to
+ * @str: String to store in the new vertex
+ *
+ * Return: Pointer to the created vertex, or NULL on failure
+ */
+vertex_t *graph_add_vertex(graph_t *graph, const char *str)
+{
+	if (!str)
+		return (NULL);
+	return (graph_add_vertex_len(graph, str, strlen(str)));
+}
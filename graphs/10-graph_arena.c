@@ -0,0 +1,116 @@
+#include <stdlib.h>
+#include <string.h>
+#include "graphs.h"
+
+#define GRAPH_SLAB_MIN 4096
+#define GRAPH_SLAB_MAX ((size_t)1 << 24)
+#define GRAPH_ARENA_ALIGN ((size_t)8)
+
+/**
+ * slab_push - Allocates a new slab and makes it the current one
+ * Slab sizes double from GRAPH_SLAB_MIN up to GRAPH_SLAB_MAX, and an
+ * oversized request gets a slab of its own
+ * @graph: Pointer to the graph owning the arena
+ * @size: Number of bytes the new slab must be able to hand out
+ *
+ * Return: Pointer to the new slab, or NULL on failure
+ */
+static graph_slab_t *slab_push(graph_t *graph, size_t size)
+{
+	graph_slab_t *slab;
+	size_t slab_size = GRAPH_SLAB_MIN;
+
+	if (graph->slabs)
+		slab_size = graph->slabs->size * 2;
+	if (slab_size > GRAPH_SLAB_MAX)
+		slab_size = GRAPH_SLAB_MAX;
+	if (slab_size < size)
+		slab_size = size;
+
+	slab = malloc(sizeof(*slab) + slab_size);
+	if (!slab)
+		return (NULL);
+	slab->next = graph->slabs;
+	slab->size = slab_size;
+	slab->used = 0;
+	graph->slabs = slab;
+	return (slab);
+}
+
+/**
+ * graph_alloc - Allocates memory for an item owned by a graph
+ * In GRAPH_ARENA mode the item is bump-allocated from the current slab,
+ * otherwise it is allocated with malloc
+ * @graph: Pointer to the graph owning the item
+ * @size: Number of bytes to allocate
+ *
+ * Return: Pointer to the allocated memory, or NULL on failure
+ */
+void *graph_alloc(graph_t *graph, size_t size)
+{
+	graph_slab_t *slab = graph->slabs;
+	void *ptr;
+
+	if (!(graph->flags & GRAPH_ARENA))
+		return (malloc(size));
+
+	size = (size + GRAPH_ARENA_ALIGN - 1) & ~(GRAPH_ARENA_ALIGN - 1);
+	if (!slab || slab->size - slab->used < size)
+	{
+		slab = slab_push(graph, size);
+		if (!slab)
+			return (NULL);
+	}
+	ptr = slab->data + slab->used;
+	slab->used += size;
+	return (ptr);
+}
+
+/**
+ * graph_strndup - Duplicates a string into memory owned by a graph
+ * @graph: Pointer to the graph owning the copy
+ * @str: String to duplicate
+ * @len: Number of bytes to copy from @str, a NUL byte is appended
+ *
+ * Return: Pointer to the copy, or NULL on failure
+ */
+char *graph_strndup(graph_t *graph, const char *str, size_t len)
+{
+	char *copy;
+
+	copy = graph_alloc(graph, len + 1);
+	if (copy)
+	{
+		memcpy(copy, str, len);
+		copy[len] = '\0';
+	}
+	return (copy);
+}
+
+/**
+ * graph_free_item - Releases an item allocated with graph_alloc
+ * Nothing is released in GRAPH_ARENA mode, the slabs go with the graph
+ * @graph: Pointer to the graph owning the item
+ * @ptr: Pointer to the item
+ */
+void graph_free_item(const graph_t *graph, void *ptr)
+{
+	if (!(graph->flags & GRAPH_ARENA))
+		free(ptr);
+}
+
+/**
+ * graph_slabs_free - Frees a list of arena slabs
+ * @slabs: Pointer to the most recent slab of the list
+ */
+void graph_slabs_free(graph_slab_t *slabs)
+{
+	graph_slab_t *next;
+
+	while (slabs)
+	{
+		next = slabs->next;
+		free(slabs);
+		slabs = next;
+	}
+}
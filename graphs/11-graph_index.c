@@ -0,0 +1,117 @@
+#include <stdlib.h>
+#include <string.h>
+#include "graphs.h"
+
+#define GRAPH_INDEX_MIN_BUCKETS 16
+
+/**
+ * index_place - Stores a vertex in the first free slot of its probe chain
+ * @buckets: Hash index to store the vertex in
+ * @nb_buckets: Size of @buckets (power of two)
+ * @vertex: Vertex to store
+ */
+static void index_place(vertex_t **buckets, size_t nb_buckets,
+			vertex_t *vertex)
+{
+	size_t mask = nb_buckets - 1;
+	size_t slot;
+
+	slot = graph_hash_content(vertex->content,
+				  strlen(vertex->content)) & mask;
+	while (buckets[slot])
+		slot = (slot + 1) & mask;
+	buckets[slot] = vertex;
+}
+
+/**
+ * index_grow - Doubles the size of the hash index and rehashes it
+ * @graph: Pointer to the graph owning the index
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int index_grow(graph_t *graph)
+{
+	vertex_t **buckets;
+	size_t nb_buckets, i;
+
+	nb_buckets = graph->nb_buckets ? graph->nb_buckets * 2 :
+		GRAPH_INDEX_MIN_BUCKETS;
+	buckets = calloc(nb_buckets, sizeof(*buckets));
+	if (!buckets)
+		return (0);
+
+	for (i = 0; i < graph->nb_buckets; i++)
+		if (graph->buckets[i])
+			index_place(buckets, nb_buckets, graph->buckets[i]);
+
+	free(graph->buckets);
+	graph->buckets = buckets;
+	graph->nb_buckets = nb_buckets;
+	return (1);
+}
+
+/**
+ * graph_index_insert - Adds a vertex to the hash index of a graph
+ * The index is kept at most 3/4 full so probe chains stay short
+ * @graph: Pointer to the graph owning the index
+ * @vertex: Vertex to index, its content must not be indexed yet
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int graph_index_insert(graph_t *graph, vertex_t *vertex)
+{
+	if ((graph->nb_vertices + 1) * 4 > graph->nb_buckets * 3 &&
+	    !index_grow(graph))
+		return (0);
+
+	index_place(graph->buckets, graph->nb_buckets, vertex);
+	return (1);
+}
+
+/**
+ * graph_index_rebuild - Re-indexes every vertex of a graph from scratch,
+ * after its vertices were moved
+ * The index keeps its size, which already fits nb_vertices
+ * @graph: Pointer to the graph owning the index
+ */
+void graph_index_rebuild(graph_t *graph)
+{
+	vertex_t *vertex;
+
+	if (!graph->nb_buckets)
+		return;
+	memset(graph->buckets, 0, graph->nb_buckets * sizeof(*graph->buckets));
+	for (vertex = graph->vertices; vertex; vertex = vertex->next)
+		if (!GRAPH_VERTEX_REMOVED(vertex))
+			index_place(graph->buckets, graph->nb_buckets, vertex);
+}
+
+/**
+ * graph_index_remove - Removes a vertex from the hash index of a graph
+ * The following entries of the probe chain are shifted back into the hole,
+ * so lookups never need tombstones
+ * @graph: Pointer to the graph owning the index
+ * @vertex: Indexed vertex to remove, its content still set
+ */
+void graph_index_remove(graph_t *graph, const vertex_t *vertex)
+{
+	size_t mask = graph->nb_buckets - 1, hole, slot, home;
+
+	hole = graph_hash_content(vertex->content,
+				  strlen(vertex->content)) & mask;
+	while (graph->buckets[hole] != vertex)
+		hole = (hole + 1) & mask;
+	for (slot = (hole + 1) & mask; graph->buckets[slot];
+	     slot = (slot + 1) & mask)
+	{
+		home = graph_hash_content(graph->buckets[slot]->content,
+			strlen(graph->buckets[slot]->content)) & mask;
+		/* Entries whose home is outside (hole, slot] move back */
+		if (((slot - home) & mask) >= ((slot - hole) & mask))
+		{
+			graph->buckets[hole] = graph->buckets[slot];
+			hole = slot;
+		}
+	}
+	graph->buckets[hole] = NULL;
+}
@@ -0,0 +1,233 @@
+#include <stdlib.h>
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "graphs.h"
+
+/**
+ * struct edgelist_s - State of an edge-list load
+ *
+ * @graph: Graph being built
+ * @nb_pairs: Number of edges read so far
+ * @pairs: Array of 2 * nb_pairs (source, destination) vertex indices
+ * @weights: Array of the nb_pairs edge weights, parallel to @pairs
+ * @cap_pairs: Number of edges @pairs and @weights have room for
+ */
+typedef struct edgelist_s
+{
+	graph_t *graph;
+	size_t nb_pairs;
+	size_t *pairs;
+	graph_weight_t *weights;
+	size_t cap_pairs;
+} edgelist_t;
+
+/**
+ * next_token - Finds the next whitespace-separated token on a line
+ * @cur: Pointer to the read position, moved past the token
+ * @end: End of the mapped data
+ * @token: Set to the start of the token
+ *
+ * Return: Length of the token, 0 at the end of the line
+ */
+static size_t next_token(const char **cur, const char *end,
+			 const char **token)
+{
+	const char *p = *cur;
+
+	while (p < end && (*p == ' ' || *p == '\t' || *p == '\r' || !*p))
+		p++;
+	*token = p;
+	while (p < end && *p != ' ' && *p != '\t' && *p != '\r' && *p &&
+	       *p != '\n')
+		p++;
+	*cur = p;
+	return (p - *token);
+}
+
+/**
+ * intern - Resolves a vertex name to its index, adding it if needed
+ * @el: Pointer to the load state
+ * @name: Name of the vertex, not NUL-terminated
+ * @len: Length of @name
+ *
+ * Return: Index of the vertex, or SIZE_MAX on failure
+ */
+static size_t intern(edgelist_t *el, const char *name, size_t len)
+{
+	vertex_t *vertex;
+
+	vertex = graph_find_vertex_len(el->graph, name, len);
+	if (!vertex)
+		vertex = graph_add_vertex_len(el->graph, name, len);
+	return (vertex ? vertex->index : SIZE_MAX);
+}
+
+/**
+ * parse - Reads every "src dest [weight]" line of an edge list
+ * Empty lines and lines starting with '#' or '%' are skipped, a missing
+ * weight is 1 and anything after the weight, or after a '#' or '%'
+ * standing for it, is ignored
+ * @el: Pointer to the load state
+ * @cur: Start of the mapped data
+ * @end: End of the mapped data
+ *
+ * Return: 1 on success, 0 on failure or malformed input
+ */
+static int parse(edgelist_t *el, const char *cur, const char *end)
+{
+	const char *src, *dest, *weight;
+	size_t src_len, dest_len, weight_len, *pairs;
+	graph_weight_t *weights;
+
+	for (; cur < end; cur++)
+	{
+		src_len = next_token(&cur, end, &src);
+		if (!src_len || *src == '#' || *src == '%')
+		{
+			while (cur < end && *cur != '\n')
+				cur++;
+			continue;
+		}
+		dest_len = next_token(&cur, end, &dest);
+		if (!dest_len)
+			return (0);
+		if (el->nb_pairs == el->cap_pairs)
+		{
+			el->cap_pairs = el->nb_pairs ? el->nb_pairs * 2 : 1024;
+			pairs = realloc(el->pairs,
+					el->cap_pairs * 2 * sizeof(*pairs));
+			if (pairs)
+				el->pairs = pairs;
+			weights = realloc(el->weights,
+					  el->cap_pairs * sizeof(*weights));
+			if (weights)
+				el->weights = weights;
+			if (!pairs || !weights)
+				return (0);
+		}
+		weight_len = next_token(&cur, end, &weight);
+		weights = el->weights + el->nb_pairs;
+		*weights = 1;
+		if (weight_len && *weight != '#' && *weight != '%' &&
+		    !graph_parse_weight(weight, weight_len, weights))
+			return (0);
+		pairs = el->pairs + el->nb_pairs++ * 2;
+		pairs[0] = intern(el, src, src_len);
+		pairs[1] = intern(el, dest, dest_len);
+		if (pairs[0] == SIZE_MAX || pairs[1] == SIZE_MAX)
+			return (0);
+		while (cur < end && *cur != '\n')
+			cur++;
+	}
+	return (1);
+}
+
+/**
+ * link_edges - Builds every adjacency list from the edges read
+ * All edges are carved from one arena block, grouped by source vertex, and
+ * chained in the order repeated graph_add_edge calls would have produced
+ * @el: Pointer to the load state
+ * @bidirectional: Whether each line also adds the reverse edge
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int link_edges(edgelist_t *el, int bidirectional)
+{
+	size_t nb_vertices = el->graph->nb_vertices, *end, *pair, i, v, e;
+	size_t nb_edges = el->nb_pairs * (bidirectional ? 2 : 1);
+	vertex_t **vertices = el->graph->by_id;
+	edge_t *edges;
+
+	edges = graph_alloc(el->graph,
+			    (nb_edges ? nb_edges : 1) * sizeof(*edges));
+	end = calloc(nb_vertices + 1, sizeof(*end));
+	if (!edges || !end)
+	{
+		free(end);
+		return (0);
+	}
+	for (i = 0, pair = el->pairs; i < el->nb_pairs; i++, pair += 2)
+	{
+		end[pair[0] + 1]++;
+		if (bidirectional)
+			end[pair[1] + 1]++;
+	}
+	for (v = 0; v < nb_vertices; v++)
+		end[v + 1] += end[v];
+	/* Newest edges first, as graph_add_edge prepends */
+	while (i--)
+	{
+		pair -= 2;
+		if (bidirectional)
+		{
+			edges[end[pair[1]]].weight = el->weights[i];
+			edges[end[pair[1]]++].dest = vertices[pair[0]];
+		}
+		edges[end[pair[0]]].weight = el->weights[i];
+		edges[end[pair[0]]++].dest = vertices[pair[1]];
+	}
+	for (v = 0, e = 0; v < nb_vertices; v++)
+	{
+		vertices[v]->nb_edges = end[v] - e;
+		vertices[v]->edges = end[v] > e ? &edges[e] : NULL;
+		for (; e < end[v]; e++)
+			edges[e].next = e + 1 < end[v] ? &edges[e + 1] : NULL;
+	}
+	free(end);
+	return (1);
+}
+
+/**
+ * graph_load_edgelist - Builds a graph from a text edge-list file
+ * Each line holds "src dest [weight]". The file is mapped rather than read,
+ * vertex names are interned straight from the mapping and the edges are
+ * linked in bulk once the whole file is parsed. The graph is always created
+ * in GRAPH_ARENA mode. With GRAPH_UNIQUE_EDGES, repeated edges are dropped
+ * @path: Path to the edge-list file
+ * @flags: GRAPH_* creation flags, plus GRAPH_LOAD_BIDIRECTIONAL to add every
+ * edge in both directions
+ *
+ * Return: Pointer to the graph, or NULL on failure
+ */
+graph_t *graph_load_edgelist(const char *path, unsigned int flags)
+{
+	edgelist_t el = {NULL, 0, NULL, NULL, 0};
+	struct stat st;
+	char *data = NULL;
+	int fd, ok;
+
+	fd = path ? open(path, O_RDONLY) : -1;
+	if (fd == -1)
+		return (NULL);
+	if (fstat(fd, &st) == -1 ||
+	    (st.st_size && (data = mmap(NULL, st.st_size, PROT_READ,
+					MAP_PRIVATE, fd, 0)) == MAP_FAILED))
+	{
+		close(fd);
+		return (NULL);
+	}
+	close(fd);
+
+	el.graph = graph_create_flags((flags & ~GRAPH_LOAD_BIDIRECTIONAL) |
+				      GRAPH_ARENA);
+	if (data)
+		madvise(data, st.st_size, MADV_SEQUENTIAL);
+	ok = el.graph && (!data || parse(&el, data, data + st.st_size)) &&
+		link_edges(&el, flags & GRAPH_LOAD_BIDIRECTIONAL) &&
+		(!(flags & GRAPH_UNIQUE_EDGES) ||
+		 graph_drop_duplicate_edges(el.graph)) &&
+		graph_edge_index_rebuild(el.graph);
+	if (data)
+		munmap(data, st.st_size);
+	free(el.pairs);
+	free(el.weights);
+	if (!ok)
+	{
+		graph_delete(el.graph);
+		return (NULL);
+	}
+	return (el.graph);
+}
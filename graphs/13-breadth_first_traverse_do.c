@@ -0,0 +1,198 @@
+#include <stdlib.h>
+#include <string.h>
+#include "graphs.h"
+
+/* Switch to bottom-up when the frontier has more than 1/ALPHA of the */
+/* unexplored edges, back to top-down below 1/BETA of the vertices */
+#define BFS_ALPHA 14
+#define BFS_BETA 24
+
+/**
+ * struct bfs_do_s - State of a direction-optimizing BFS
+ * The current level is queue[lo] .. queue[hi - 1], the next one is appended
+ * at queue[tail], so the queue ends up holding every vertex in BFS order
+ *
+ * @csr: Snapshot being traversed
+ * @rev: Reversed snapshot, used to find parents in bottom-up steps
+ * @visited: Bitset of vertices already reached
+ * @frontier: Bitset of vertices in the current level (bottom-up steps only)
+ * @queue: Array of nb_vertices vertex indices
+ * @lo: Start of the current level in @queue
+ * @hi: End of the current level in @queue
+ * @tail: End of the next level in @queue
+ * @unexplored: Number of edges leaving vertices not reached yet
+ */
+typedef struct bfs_do_s
+{
+	const graph_csr_t *csr;
+	const graph_csr_t *rev;
+	uint64_t *visited;
+	uint64_t *frontier;
+	size_t *queue;
+	size_t lo;
+	size_t hi;
+	size_t tail;
+	size_t unexplored;
+} bfs_do_t;
+
+/**
+ * reach - Marks a vertex as reached and appends it to the next level
+ * @bfs: Pointer to the BFS state
+ * @v: Index of the vertex
+ *
+ * Return: Number of edges leaving @v
+ */
+static size_t reach(bfs_do_t *bfs, size_t v)
+{
+	size_t degree = bfs->csr->offsets[v + 1] - bfs->csr->offsets[v];
+
+	BITSET_SET(bfs->visited, v);
+	bfs->queue[bfs->tail++] = v;
+	bfs->unexplored -= degree;
+	return (degree);
+}
+
+/**
+ * top_down_step - Expands the current level by scanning its out-edges
+ * @bfs: Pointer to the BFS state
+ *
+ * Return: Number of edges leaving the next level
+ */
+static size_t top_down_step(bfs_do_t *bfs)
+{
+	const graph_csr_t *csr = bfs->csr;
+	size_t i, e, edges = 0;
+
+	for (i = bfs->lo; i < bfs->hi; i++)
+		for (e = csr->offsets[bfs->queue[i]];
+		     e < csr->offsets[bfs->queue[i] + 1]; e++)
+			if (!BITSET_TEST(bfs->visited, csr->dests[e]))
+				edges += reach(bfs, csr->dests[e]);
+	return (edges);
+}
+
+/**
+ * bottom_up_step - Expands the current level by letting every vertex not
+ * reached yet look for a parent in it
+ * @bfs: Pointer to the BFS state
+ *
+ * Return: Number of edges leaving the next level
+ */
+static size_t bottom_up_step(bfs_do_t *bfs)
+{
+	const graph_csr_t *rev = bfs->rev;
+	size_t n = rev->nb_vertices, w, v, e, edges = 0;
+	uint64_t bits;
+
+	memset(bfs->frontier, 0, BITSET_WORDS(n) * sizeof(uint64_t));
+	for (v = bfs->lo; v < bfs->hi; v++)
+		BITSET_SET(bfs->frontier, bfs->queue[v]);
+
+	for (w = 0; w < BITSET_WORDS(n); w++)
+	{
+		bits = ~bfs->visited[w];
+		if (w == n / 64)
+			bits &= ((uint64_t)1 << (n % 64)) - 1;
+		for (; bits; bits &= bits - 1)
+		{
+			v = w * 64 + __builtin_ctzll(bits);
+			for (e = rev->offsets[v]; e < rev->offsets[v + 1]; e++)
+				if (BITSET_TEST(bfs->frontier, rev->dests[e]))
+				{
+					edges += reach(bfs, v);
+					break;
+				}
+		}
+	}
+	return (edges);
+}
+
+/**
+ * csr_breadth_first_traverse_do - Traverses a CSR snapshot using a
+ * direction-optimizing BFS
+ * Levels are expanded top-down while they are small, and bottom-up once the
+ * frontier grows large. Every vertex is reported at the same depth as with
+ * csr_breadth_first_traverse, but vertices discovered bottom-up are reported
+ * by increasing index within their level
+ * @csr: Pointer to the snapshot to traverse, from its first vertex that is
+ * not removed
+ * @rev: Pointer to graph_csr_transpose(@csr), or @csr itself when every
+ * edge is bidirectional
+ * @action: Function to be called for each visited vertex
+ *
+ * Return: The maximum depth reached, or 0 on failure
+ */
+size_t csr_breadth_first_traverse_do(const graph_csr_t *csr,
+	const graph_csr_t *rev,
+	void (*action)(const vertex_t *v, size_t depth))
+{
+	bfs_do_t bfs;
+	size_t depth = 0, words, i, v, edges;
+	vertex_t stub;
+	int bottom_up = 0;
+
+	if (!csr || !rev || !action)
+		return (0);
+	v = graph_csr_first(csr);
+	if (v == csr->nb_vertices)
+		return (0);
+	memset(&bfs, 0, sizeof(bfs));
+	bfs.csr = csr;
+	bfs.rev = rev;
+	bfs.unexplored = csr->nb_edges;
+	words = BITSET_WORDS(csr->nb_vertices);
+	bfs.visited = calloc(words, sizeof(uint64_t));
+	bfs.frontier = malloc(words * sizeof(uint64_t));
+	bfs.queue = malloc(csr->nb_vertices * sizeof(size_t));
+	if (bfs.visited && bfs.frontier && bfs.queue)
+	{
+		edges = reach(&bfs, v);
+		for (bfs.hi = bfs.tail; bfs.lo < bfs.hi; depth++)
+		{
+			for (i = bfs.lo; i < bfs.hi; i++)
+			{
+				v = bfs.queue[i];
+				action(graph_csr_vertex(csr, v, &stub), depth);
+			}
+			if (!bottom_up && edges > bfs.unexplored / BFS_ALPHA)
+				bottom_up = 1;
+			else if (bottom_up &&
+				 bfs.hi - bfs.lo < csr->nb_vertices / BFS_BETA)
+				bottom_up = 0;
+			if (bottom_up)
+				edges = bottom_up_step(&bfs);
+			else
+				edges = top_down_step(&bfs);
+			bfs.lo = bfs.hi;
+			bfs.hi = bfs.tail;
+		}
+		depth--;
+	}
+	free(bfs.visited);
+	free(bfs.frontier);
+	free(bfs.queue);
+	return (depth);
+}
+
+/**
+ * breadth_first_traverse_do - Traverses a graph using a direction-optimizing
+ * BFS, see csr_breadth_first_traverse_do
+ * The graph is frozen, and its snapshot reversed, for the traversal only
+ * @graph: Pointer to the graph to traverse
+ * @action: Function to be called for each visited vertex
+ *
+ * Return: The maximum depth reached, or 0 on failure
+ */
+size_t breadth_first_traverse_do(const graph_t *graph,
+	void (*action)(const vertex_t *v, size_t depth))
+{
+	graph_csr_t *csr, *rev;
+	size_t max_depth;
+
+	csr = graph_freeze(graph);
+	rev = graph_csr_transpose(csr);
+	max_depth = csr_breadth_first_traverse_do(csr, rev, action);
+	graph_csr_delete(csr);
+	graph_csr_delete(rev);
+	return (max_depth);
+}
@@ -0,0 +1,220 @@
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "graphs.h"
+
+#define BFS_MT_CHUNK 64
+#define BFS_MT_LOCAL 1024
+
+/**
+ * struct bfs_mt_s - State shared by the threads of a parallel BFS
+ *
+ * @csr: Snapshot being traversed
+ * @action: Function to call for each visited vertex, or NULL
+ * @depths: Array receiving the depth of each vertex, or NULL
+ * @visited: Bitset of vertices already claimed by a thread
+ * @frontier: Array of the vertices of the current level
+ * @next: Array receiving the vertices of the next level
+ * @nb_frontier: Number of vertices in @frontier
+ * @nb_next: Number of vertices in @next
+ * @claimed: Number of @frontier vertices already handed to a thread
+ * @depth: Depth of the current level
+ * @barrier: Barrier separating the levels
+ * @start: Mutex held until @barrier is initialized for the threads started
+ */
+typedef struct bfs_mt_s
+{
+	const graph_csr_t *csr;
+	void (*action)(const vertex_t *v, size_t depth);
+	size_t *depths;
+	uint64_t *visited;
+	size_t *frontier;
+	size_t *next;
+	size_t nb_frontier;
+	size_t nb_next;
+	size_t claimed;
+	size_t depth;
+	pthread_barrier_t barrier;
+	pthread_mutex_t start;
+} bfs_mt_t;
+
+/**
+ * flush - Appends a thread-local buffer to the next level
+ * @bfs: Pointer to the shared state
+ * @local: Buffer of vertices claimed by the thread
+ * @count: Number of vertices in @local
+ */
+static void flush(bfs_mt_t *bfs, const size_t *local, size_t count)
+{
+	size_t at;
+
+	at = __atomic_fetch_add(&bfs->nb_next, count, __ATOMIC_RELAXED);
+	memcpy(bfs->next + at, local, count * sizeof(*local));
+}
+
+/**
+ * expand - Claims the unvisited neighbours of a chunk of the frontier
+ * @bfs: Pointer to the shared state
+ * @from: Index of the first frontier vertex of the chunk
+ * @to: Index past the last frontier vertex of the chunk
+ * @local: Thread-local buffer of claimed vertices
+ * @count: Pointer to the number of vertices in @local
+ */
+static void expand(bfs_mt_t *bfs, size_t from, size_t to, size_t *local,
+		   size_t *count)
+{
+	const graph_csr_t *csr = bfs->csr;
+	size_t e, u;
+	uint64_t bit, old, *word;
+	vertex_t stub;
+
+	for (; from < to; from++)
+		for (e = csr->offsets[bfs->frontier[from]];
+		     e < csr->offsets[bfs->frontier[from] + 1]; e++)
+		{
+			u = csr->dests[e];
+			word = &bfs->visited[u >> 6];
+			bit = (uint64_t)1 << (u & 63);
+			if (__atomic_load_n(word, __ATOMIC_RELAXED) & bit)
+				continue;
+			/* Test-and-set, only one thread claims the vertex */
+			old = __atomic_fetch_or(word, bit, __ATOMIC_RELAXED);
+			if (old & bit)
+				continue;
+			if (bfs->depths)
+				bfs->depths[u] = bfs->depth + 1;
+			if (bfs->action)
+				bfs->action(graph_csr_vertex(csr, u, &stub),
+					    bfs->depth + 1);
+			local[(*count)++] = u;
+			if (*count == BFS_MT_LOCAL)
+			{
+				flush(bfs, local, *count);
+				*count = 0;
+			}
+		}
+}
+
+/**
+ * bfs_mt_worker - Body of every thread of a parallel BFS
+ * Each level, the threads grab chunks of the frontier until it is
+ * exhausted, then one of them turns the next level into the frontier
+ * @arg: Pointer to the shared state
+ *
+ * Return: Always NULL
+ */
+static void *bfs_mt_worker(void *arg)
+{
+	bfs_mt_t *bfs = arg;
+	size_t local[BFS_MT_LOCAL], count, from, to, *swap;
+
+	pthread_mutex_lock(&bfs->start);
+	pthread_mutex_unlock(&bfs->start);
+	while (1)
+	{
+		pthread_barrier_wait(&bfs->barrier);
+		if (!bfs->nb_frontier)
+			break;
+		count = 0;
+		while (1)
+		{
+			from = __atomic_fetch_add(&bfs->claimed, BFS_MT_CHUNK,
+						  __ATOMIC_RELAXED);
+			if (from >= bfs->nb_frontier)
+				break;
+			to = from + BFS_MT_CHUNK;
+			expand(bfs, from, to < bfs->nb_frontier ? to :
+			       bfs->nb_frontier, local, &count);
+		}
+		flush(bfs, local, count);
+		if (pthread_barrier_wait(&bfs->barrier) ==
+		    PTHREAD_BARRIER_SERIAL_THREAD)
+		{
+			swap = bfs->frontier;
+			bfs->frontier = bfs->next;
+			bfs->next = swap;
+			bfs->nb_frontier = bfs->nb_next;
+			bfs->nb_next = 0;
+			bfs->claimed = 0;
+			if (bfs->nb_frontier)
+				bfs->depth++;
+		}
+	}
+	return (NULL);
+}
+
+/**
+ * csr_breadth_first_traverse_mt - Traverses a CSR snapshot using a parallel,
+ * level-synchronous BFS
+ * Every vertex gets the same depth as with csr_breadth_first_traverse, but
+ * vertices of a level are visited in no particular order, and @action is
+ * called concurrently from all threads
+ * @csr: Pointer to the snapshot to traverse, from its first vertex that is
+ * not removed
+ * @nb_threads: Number of threads to use, 0 for one per online CPU
+ * @depths: If not NULL, array of nb_vertices receiving the depth of each
+ * vertex, or SIZE_MAX for vertices that are not reached
+ * @action: Thread-safe function to be called for each visited vertex,
+ * may be NULL when @depths is given
+ *
+ * Return: The maximum depth reached, or 0 on failure
+ */
+size_t csr_breadth_first_traverse_mt(const graph_csr_t *csr,
+	size_t nb_threads, size_t *depths,
+	void (*action)(const vertex_t *v, size_t depth))
+{
+	bfs_mt_t bfs;
+	pthread_t *threads;
+	vertex_t stub;
+	size_t started = 1, root;
+
+	if (!csr || (!action && !depths))
+		return (0);
+	root = graph_csr_first(csr);
+	if (root == csr->nb_vertices)
+		return (0);
+	if (!nb_threads)
+		nb_threads = sysconf(_SC_NPROCESSORS_ONLN) > 0 ?
+			sysconf(_SC_NPROCESSORS_ONLN) : 1;
+	memset(&bfs, 0, sizeof(bfs));
+	bfs.csr = csr;
+	bfs.action = action;
+	bfs.depths = depths;
+	bfs.visited = calloc(BITSET_WORDS(csr->nb_vertices),
+			     sizeof(*bfs.visited));
+	bfs.frontier = malloc(csr->nb_vertices * sizeof(size_t));
+	bfs.next = malloc(csr->nb_vertices * sizeof(size_t));
+	threads = malloc(nb_threads * sizeof(*threads));
+	if (bfs.visited && bfs.frontier && bfs.next && threads)
+	{
+		if (depths)
+		{
+			memset(depths, 0xff, csr->nb_vertices * sizeof(size_t));
+			depths[root] = 0;
+		}
+		BITSET_SET(bfs.visited, root);
+		bfs.frontier[bfs.nb_frontier++] = root;
+		if (action)
+			action(graph_csr_vertex(csr, root, &stub), 0);
+		/* Threads that fail to start leave their share to the others */
+		pthread_mutex_init(&bfs.start, NULL);
+		pthread_mutex_lock(&bfs.start);
+		for (; started < nb_threads; started++)
+			if (pthread_create(&threads[started], NULL,
+					   bfs_mt_worker, &bfs))
+				break;
+		pthread_barrier_init(&bfs.barrier, NULL, started);
+		pthread_mutex_unlock(&bfs.start);
+		bfs_mt_worker(&bfs);
+		while (--started)
+			pthread_join(threads[started], NULL);
+		pthread_barrier_destroy(&bfs.barrier);
+		pthread_mutex_destroy(&bfs.start);
+	}
+	free(bfs.visited);
+	free(bfs.frontier);
+	free(bfs.next);
+	free(threads);
+	return (bfs.depth);
+}
@@ -0,0 +1,133 @@
+#include <stdlib.h>
+#include "graphs.h"
+
+#define DFS_ITER_MIN_FRAMES 64
+
+/**
+ * dfs_push - Marks a vertex as visited and pushes its frame on the stack
+ * The stack doubles in size whenever it is full
+ * @iter: Pointer to the iterator
+ * @vertex: Vertex to push
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int dfs_push(graph_dfs_iter_t *iter, const vertex_t *vertex)
+{
+	dfs_frame_t *stack;
+	size_t capacity;
+
+	if (iter->size == iter->capacity)
+	{
+		capacity = iter->capacity * 2;
+		stack = realloc(iter->stack, capacity * sizeof(*stack));
+		if (!stack)
+			return (0);
+		iter->stack = stack;
+		iter->capacity = capacity;
+	}
+	BITSET_SET(iter->visited, vertex->index);
+	iter->stack[iter->size].vertex = vertex;
+	iter->stack[iter->size].edge = vertex->edges;
+	iter->size++;
+	return (1);
+}
+
+/**
+ * graph_dfs_iter_create - Creates a depth-first iterator over a graph
+ * The graph must not be modified while the iterator is in use
+ * @graph: Pointer to the graph to traverse
+ * @start: Vertex to start from, or NULL for the first vertex of @graph that
+ * is not removed
+ *
+ * Return: Pointer to the iterator, or NULL on failure
+ */
+graph_dfs_iter_t *graph_dfs_iter_create(const graph_t *graph,
+					const vertex_t *start)
+{
+	graph_dfs_iter_t *iter;
+
+	if (!graph || !graph->vertices)
+		return (NULL);
+	if (!start)
+		for (start = graph->vertices; GRAPH_VERTEX_REMOVED(start) &&
+		     start->next;)
+			start = start->next;
+	if (GRAPH_VERTEX_REMOVED(start))
+		return (NULL);
+
+	iter = calloc(1, sizeof(*iter));
+	if (!iter)
+		return (NULL);
+	iter->capacity = DFS_ITER_MIN_FRAMES;
+	iter->visited = calloc(BITSET_WORDS(graph->nb_vertices),
+			       sizeof(*iter->visited));
+	iter->stack = malloc(iter->capacity * sizeof(*iter->stack));
+	if (!iter->visited || !iter->stack || !dfs_push(iter, start))
+	{
+		graph_dfs_iter_delete(iter);
+		return (NULL);
+	}
+	iter->pending = start;
+	return (iter);
+}
+
+/**
+ * graph_dfs_iter_next - Moves a depth-first iterator to the next vertex
+ * Vertices come in the same order, and at the same depths, as the ones
+ * depth_first_traverse passes to its action
+ * @iter: Pointer to the iterator
+ * @depth: If not NULL, receives the depth of the returned vertex
+ *
+ * Return: Pointer to the next vertex, or NULL once the traversal is over
+ * or on failure, in which case iter->error is set
+ */
+const vertex_t *graph_dfs_iter_next(graph_dfs_iter_t *iter, size_t *depth)
+{
+	dfs_frame_t *top;
+	const vertex_t *vertex = NULL;
+
+	if (!iter)
+		return (NULL);
+
+	if (iter->pending)
+	{
+		vertex = iter->pending;
+		iter->pending = NULL;
+	}
+	while (!vertex && iter->size)
+	{
+		top = &iter->stack[iter->size - 1];
+		if (!top->edge)
+		{
+			iter->size--;
+			continue;
+		}
+		vertex = top->edge->dest;
+		top->edge = top->edge->next;
+		if (GRAPH_VERTEX_REMOVED(vertex) ||
+		    BITSET_TEST(iter->visited, vertex->index))
+			vertex = NULL;
+		else if (!dfs_push(iter, vertex))
+		{
+			iter->error = 1;
+			return (NULL);
+		}
+	}
+	if (vertex && depth)
+		*depth = iter->size - 1;
+	return (vertex);
+}
+
+/**
+ * graph_dfs_iter_delete - Frees a depth-first iterator
+ * @iter: Pointer to the iterator
+ */
+void graph_dfs_iter_delete(graph_dfs_iter_t *iter)
+{
+	if (!iter)
+		return;
+
+	free(iter->visited);
+	free(iter->stack);
+	free(iter);
+}
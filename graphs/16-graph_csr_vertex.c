@@ -0,0 +1,76 @@
+#include "graphs.h"
+
+/**
+ * graph_csr_content - Gets the name of a vertex of a CSR snapshot
+ * @csr: Pointer to the snapshot
+ * @v: Index of the vertex
+ *
+ * Return: The name of the vertex
+ */
+const char *graph_csr_content(const graph_csr_t *csr, size_t v)
+{
+	if (csr->vertices)
+		return (GRAPH_VERTEX_REMOVED(csr->vertices[v]) ? "" :
+			csr->vertices[v]->content);
+	return (csr->strings + csr->names[v]);
+}
+
+/**
+ * graph_csr_vertex - Gets the vertex to pass to a traversal action
+ * A mapped snapshot has no vertex_t, so @stub is filled with the index,
+ * name and number of edges of the vertex instead. Its content lives in a
+ * read-only mapping and it has no edges list
+ * @csr: Pointer to the snapshot
+ * @v: Index of the vertex
+ * @stub: Vertex to fill in when the snapshot has no vertices
+ *
+ * Return: Pointer to the vertex, or to @stub
+ */
+const vertex_t *graph_csr_vertex(const graph_csr_t *csr, size_t v,
+				 vertex_t *stub)
+{
+	if (csr->vertices)
+		return (csr->vertices[v]);
+
+	stub->index = v;
+	stub->content = (char *)(csr->strings + csr->names[v]);
+	stub->nb_edges = csr->offsets[v + 1] - csr->offsets[v];
+	stub->edges = NULL;
+	stub->next = NULL;
+	return (stub);
+}
+
+/**
+ * graph_csr_removed - Tells whether a vertex of a snapshot was removed
+ * Removed vertices keep their index in a snapshot, without any edge. A
+ * snapshot of a graph tests the vertex itself, a mapped one its name,
+ * which is empty
+ * @csr: Pointer to the snapshot
+ * @v: Index of the vertex
+ *
+ * Return: 1 if the vertex was removed, 0 otherwise
+ */
+int graph_csr_removed(const graph_csr_t *csr, size_t v)
+{
+	if (csr->vertices)
+		return (GRAPH_VERTEX_REMOVED(csr->vertices[v]));
+	return (!csr->strings[csr->names[v]]);
+}
+
+/**
+ * graph_csr_first - Finds the vertex the traversals of a snapshot start from
+ * Removed vertices are skipped, see graph_csr_removed
+ * @csr: Pointer to the snapshot
+ *
+ * Return: Index of the first vertex that is not removed, or nb_vertices if
+ * there is none
+ */
+size_t graph_csr_first(const graph_csr_t *csr)
+{
+	size_t v;
+
+	for (v = 0; v < csr->nb_vertices; v++)
+		if (!graph_csr_removed(csr, v))
+			break;
+	return (v);
+}
@@ -0,0 +1,83 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "graphs.h"
+
+/**
+ * write_names - Writes the names array and the name pool of a snapshot,
+ * with its weights array, if any, in between
+ * @csr: Pointer to the snapshot
+ * @file: File to write to
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int write_names(const graph_csr_t *csr, FILE *file)
+{
+	size_t v, offset = 0;
+	const char *name;
+
+	for (v = 0; v < csr->nb_vertices; v++)
+	{
+		if (fwrite(&offset, sizeof(offset), 1, file) != 1)
+			return (0);
+		offset += strlen(graph_csr_content(csr, v)) + 1;
+	}
+	if (csr->weights && fwrite(csr->weights, sizeof(*csr->weights),
+				   csr->nb_edges, file) != csr->nb_edges)
+		return (0);
+	for (v = 0; v < csr->nb_vertices; v++)
+	{
+		name = graph_csr_content(csr, v);
+		if (fwrite(name, strlen(name) + 1, 1, file) != 1)
+			return (0);
+	}
+	return (1);
+}
+
+/**
+ * graph_save_binary - Saves a CSR snapshot to a binary file
+ * The file holds a graph_file_header_t followed by the raw arrays of the
+ * snapshot, so graph_open_mapped can serve traversals straight from it.
+ * Integers are stored in the byte order and size_t width of this machine,
+ * weights, if the snapshot has any, as the graph_weight_t of this build
+ * @csr: Pointer to the snapshot to save
+ * @path: Path of the file to create or truncate
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int graph_save_binary(const graph_csr_t *csr, const char *path)
+{
+	graph_file_header_t header;
+	FILE *file;
+	size_t v;
+	int ok;
+
+	if (!csr || !path)
+		return (0);
+
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, GRAPH_FILE_MAGIC, sizeof(header.magic));
+	header.version = GRAPH_FILE_VERSION;
+	header.byte_order = GRAPH_FILE_BYTE_ORDER;
+	header.word_size = sizeof(size_t);
+	header.nb_vertices = csr->nb_vertices;
+	header.nb_edges = csr->nb_edges;
+	if (csr->weights)
+		header.flags = GRAPH_FILE_WEIGHTED |
+			GRAPH_WEIGHT_KIND << GRAPH_FILE_WEIGHT_SHIFT;
+	for (v = 0; v < csr->nb_vertices; v++)
+		header.strings_size += strlen(graph_csr_content(csr, v)) + 1;
+
+	file = fopen(path, "wb");
+	if (!file)
+		return (0);
+	ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+		fwrite(csr->offsets, sizeof(size_t), csr->nb_vertices + 1,
+		       file) == csr->nb_vertices + 1 &&
+		fwrite(csr->dests, sizeof(size_t), csr->nb_edges,
+		       file) == csr->nb_edges &&
+		write_names(csr, file);
+	if (fclose(file) != 0)
+		ok = 0;
+	return (ok);
+}
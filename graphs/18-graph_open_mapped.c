@@ -0,0 +1,103 @@
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "graphs.h"
+
+/**
+ * check_header - Checks that a mapped file holds a snapshot this machine
+ * can use as is
+ * Both counts are bounded by the size of the file before they are summed,
+ * so a crafted header cannot wrap the sizes around
+ * @header: Pointer to the header at the start of the mapping
+ * @size: Size of the mapping in bytes
+ *
+ * Return: 1 if the file is usable, 0 otherwise
+ */
+static int check_header(const graph_file_header_t *header, size_t size)
+{
+	uint64_t words, max, weights = 0;
+
+	if (size < sizeof(*header) ||
+	    memcmp(header->magic, GRAPH_FILE_MAGIC, sizeof(header->magic)) ||
+	    header->version != GRAPH_FILE_VERSION ||
+	    header->byte_order != GRAPH_FILE_BYTE_ORDER ||
+	    header->word_size != sizeof(size_t))
+		return (0);
+	max = (size - sizeof(*header)) / sizeof(size_t);
+	if (header->nb_vertices > max || header->nb_edges > max)
+		return (0);
+	/* Weights are only usable by a build with the same weight type */
+	if (header->flags == (GRAPH_FILE_WEIGHTED |
+			      GRAPH_WEIGHT_KIND << GRAPH_FILE_WEIGHT_SHIFT))
+		weights = header->nb_edges * sizeof(graph_weight_t);
+	else if (header->flags)
+		return (0);
+
+	words = header->nb_vertices * 2 + 1 + header->nb_edges;
+	if (words > max ||
+	    weights > size - sizeof(*header) - words * sizeof(size_t) ||
+	    header->strings_size != size - sizeof(*header) -
+	    words * sizeof(size_t) - weights)
+		return (0);
+	return (1);
+}
+
+/**
+ * graph_open_mapped - Opens a binary snapshot file saved by
+ * graph_save_binary
+ * The file is mapped read-only and the snapshot arrays point straight into
+ * the mapping, so nothing is parsed or copied and processes opening the
+ * same file share its pages. Only the header and sizes are checked, the
+ * contents of the file are trusted
+ * @path: Path of the file to open
+ *
+ * Return: Pointer to the snapshot, to be released with graph_csr_delete,
+ * or NULL on failure
+ */
+graph_csr_t *graph_open_mapped(const char *path)
+{
+	const graph_file_header_t *header;
+	graph_csr_t *csr;
+	struct stat st;
+	void *mapping;
+	int fd;
+
+	fd = path ? open(path, O_RDONLY) : -1;
+	if (fd == -1)
+		return (NULL);
+	if (fstat(fd, &st) == -1 || st.st_size <= 0)
+	{
+		close(fd);
+		return (NULL);
+	}
+	mapping = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (mapping == MAP_FAILED)
+		return (NULL);
+
+	header = mapping;
+	csr = calloc(1, sizeof(*csr));
+	if (!csr || !check_header(header, st.st_size))
+	{
+		free(csr);
+		munmap(mapping, st.st_size);
+		return (NULL);
+	}
+	csr->mapping = mapping;
+	csr->mapping_size = st.st_size;
+	csr->nb_vertices = header->nb_vertices;
+	csr->nb_edges = header->nb_edges;
+	csr->offsets = (size_t *)(header + 1);
+	csr->dests = csr->offsets + csr->nb_vertices + 1;
+	csr->names = csr->dests + csr->nb_edges;
+	csr->strings = (const char *)(csr->names + csr->nb_vertices);
+	if (header->flags & GRAPH_FILE_WEIGHTED)
+	{
+		csr->weights = (graph_weight_t *)csr->strings;
+		csr->strings += csr->nb_edges * sizeof(graph_weight_t);
+	}
+	return (csr);
+}
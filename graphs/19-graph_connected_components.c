@@ -0,0 +1,197 @@
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "graphs.h"
+
+/* A union-find node packs its rank above the index of its parent, so one */
+/* CAS checks both that a vertex is still a root and that its rank holds */
+#define UF_RANK_SHIFT 58
+#define UF_PARENT(node) ((node) & (((uint64_t)1 << UF_RANK_SHIFT) - 1))
+#define UF_RANK(node) ((node) >> UF_RANK_SHIFT)
+#define UF_NODE(parent, rank) ((uint64_t)(parent) | \
+			       (uint64_t)(rank) << UF_RANK_SHIFT)
+#define CC_CHUNK 1024
+
+/**
+ * struct cc_s - State shared by the threads labelling components
+ *
+ * @csr: Snapshot whose edges are merged
+ * @nodes: Array of nb_vertices packed union-find nodes
+ * @claimed: Number of vertices whose edges are already handed to a thread
+ */
+typedef struct cc_s
+{
+	const graph_csr_t *csr;
+	uint64_t *nodes;
+	size_t claimed;
+} cc_t;
+
+/**
+ * uf_find - Finds the root of the set of a vertex, halving the path to it
+ * @nodes: Array of packed union-find nodes
+ * @v: Index of the vertex
+ *
+ * Return: Index of the root
+ */
+static size_t uf_find(uint64_t *nodes, size_t v)
+{
+	uint64_t node, up;
+
+	while (1)
+	{
+		node = __atomic_load_n(&nodes[v], __ATOMIC_ACQUIRE);
+		if (UF_PARENT(node) == v)
+			return (v);
+		up = __atomic_load_n(&nodes[UF_PARENT(node)], __ATOMIC_ACQUIRE);
+		if (UF_PARENT(up) != UF_PARENT(node))
+			__atomic_compare_exchange_n(&nodes[v], &node,
+				UF_NODE(UF_PARENT(up), UF_RANK(node)), 0,
+				__ATOMIC_RELEASE, __ATOMIC_RELAXED);
+		v = UF_PARENT(node);
+	}
+}
+
+/**
+ * uf_union - Merges the sets of two vertices, by rank then by index
+ * The root ranked lower is linked under the other one only if it is still
+ * a root with the rank it was compared with, otherwise the merge restarts
+ * @nodes: Array of packed union-find nodes
+ * @a: Index of the first vertex
+ * @b: Index of the second vertex
+ */
+static void uf_union(uint64_t *nodes, size_t a, size_t b)
+{
+	uint64_t node_a, node_b;
+	size_t root;
+
+	while (1)
+	{
+		a = uf_find(nodes, a);
+		b = uf_find(nodes, b);
+		if (a == b)
+			return;
+		node_a = __atomic_load_n(&nodes[a], __ATOMIC_ACQUIRE);
+		node_b = __atomic_load_n(&nodes[b], __ATOMIC_ACQUIRE);
+		if (UF_RANK(node_a) > UF_RANK(node_b) ||
+		    (UF_RANK(node_a) == UF_RANK(node_b) && a < b))
+		{
+			root = a;
+			a = b;
+			b = root;
+			node_a = node_b;
+			node_b = __atomic_load_n(&nodes[b], __ATOMIC_ACQUIRE);
+		}
+		if (UF_PARENT(node_a) != a || UF_PARENT(node_b) != b)
+			continue;
+		if (!__atomic_compare_exchange_n(&nodes[a], &node_a,
+			UF_NODE(b, UF_RANK(node_a)), 0,
+			__ATOMIC_ACQ_REL, __ATOMIC_RELAXED))
+			continue;
+		if (UF_RANK(node_a) == UF_RANK(node_b))
+			__atomic_compare_exchange_n(&nodes[b], &node_b,
+				UF_NODE(b, UF_RANK(node_b) + 1), 0,
+				__ATOMIC_ACQ_REL, __ATOMIC_RELAXED);
+		return;
+	}
+}
+
+/**
+ * cc_worker - Body of every thread merging the endpoints of the edges
+ * Threads grab the out-edges of CC_CHUNK vertices at a time
+ * @arg: Pointer to the shared state
+ *
+ * Return: Always NULL
+ */
+static void *cc_worker(void *arg)
+{
+	cc_t *cc = arg;
+	const graph_csr_t *csr = cc->csr;
+	size_t v, to, e;
+
+	while ((v = __atomic_fetch_add(&cc->claimed, CC_CHUNK,
+				       __ATOMIC_RELAXED)) < csr->nb_vertices)
+	{
+		to = v + CC_CHUNK < csr->nb_vertices ? v + CC_CHUNK :
+			csr->nb_vertices;
+		for (; v < to; v++)
+			for (e = csr->offsets[v]; e < csr->offsets[v + 1]; e++)
+				uf_union(cc->nodes, v, csr->dests[e]);
+	}
+	return (NULL);
+}
+
+/**
+ * csr_connected_components - Labels the connected components of a CSR
+ * snapshot, ignoring the direction of its edges
+ * Edges are merged in parallel into a lock-free union-find with path
+ * halving and union by rank
+ * @csr: Pointer to the snapshot
+ * @nb_threads: Number of threads to use, 0 for one per online CPU
+ * @labels: Array of nb_vertices receiving the component of each vertex.
+ * Components are numbered from 0 by increasing smallest vertex index
+ *
+ * Return: The number of components, or 0 on failure
+ */
+size_t csr_connected_components(const graph_csr_t *csr, size_t nb_threads,
+				size_t *labels)
+{
+	cc_t cc = {NULL, NULL, 0};
+	pthread_t *threads;
+	size_t started = 1, v, root, count = 0;
+
+	if (!csr || !labels || !csr->nb_vertices)
+		return (0);
+	if (!nb_threads)
+		nb_threads = sysconf(_SC_NPROCESSORS_ONLN) > 0 ?
+			sysconf(_SC_NPROCESSORS_ONLN) : 1;
+	cc.csr = csr;
+	cc.nodes = malloc(csr->nb_vertices * sizeof(*cc.nodes));
+	threads = malloc(nb_threads * sizeof(*threads));
+	if (cc.nodes && threads)
+	{
+		for (v = 0; v < csr->nb_vertices; v++)
+			cc.nodes[v] = UF_NODE(v, 0);
+		for (; started < nb_threads; started++)
+			if (pthread_create(&threads[started], NULL,
+					   cc_worker, &cc))
+				break;
+		cc_worker(&cc);
+		while (--started)
+			pthread_join(threads[started], NULL);
+		/* A set is labelled at its root when its first vertex is met */
+		memset(labels, 0xff, csr->nb_vertices * sizeof(*labels));
+		for (v = 0; v < csr->nb_vertices; v++)
+		{
+			root = uf_find(cc.nodes, v);
+			if (labels[root] == SIZE_MAX)
+				labels[root] = count++;
+			labels[v] = labels[root];
+		}
+	}
+	free(cc.nodes);
+	free(threads);
+	return (count);
+}
+
+/**
+ * graph_connected_components - Labels the connected components of a graph,
+ * see csr_connected_components
+ * @graph: Pointer to the graph
+ * @nb_threads: Number of threads to use, 0 for one per online CPU
+ * @labels: Array of nb_vertices receiving the component of each vertex,
+ * indexed by vertex_t.index
+ *
+ * Return: The number of components, or 0 on failure
+ */
+size_t graph_connected_components(const graph_t *graph, size_t nb_threads,
+				  size_t *labels)
+{
+	graph_csr_t *csr;
+	size_t count;
+
+	csr = graph_freeze(graph);
+	count = csr_connected_components(csr, nb_threads, labels);
+	graph_csr_delete(csr);
+	return (count);
+}
@@ -1,51 +1,165 @@
 #include "graphs.h"
 #include <stdlib.h>
 
+/**
+ * find_or_add_vertex - Looks up a vertex, creating it if it does not exist
+ * @graph: A pointer to the graph
+ * @content: The string identifying the vertex
+ *
+ * Return: A pointer to the vertex, or NULL on failure
+ */
+static vertex_t *find_or_add_vertex(graph_t *graph, const char *content)
+{
+    vertex_t *vertex;
+
+    vertex = graph_find_vertex(graph, content);
+    if (!vertex)
+        vertex = graph_add_vertex(graph, content);
+    return (vertex);
+}
+
+/**
+ * link_edge - Prepends an edge to the list of a vertex and indexes it
+ * @graph: A pointer to the graph
+ * @src: The vertex the edge leaves
+ * @dest: The vertex the edge leads to
+ * @weight: The weight of the edge
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int link_edge(graph_t *graph, vertex_t *src, vertex_t *dest,
+                     graph_weight_t weight)
+{
+    edge_t *new_edge;
+
+    new_edge = graph_alloc(graph, sizeof(edge_t));
+    if (!new_edge)
+    {
+        return (0);
+    }
+
+    new_edge->dest = dest;
+    new_edge->weight = weight;
+    new_edge->next = src->edges;
+    src->edges = new_edge;
+    src->nb_edges++;
+
+    if (!graph_edge_index_add(graph, src))
+    {
+        src->edges = new_edge->next;
+        src->nb_edges--;
+        graph_free_item(graph, new_edge);
+        return (0);
+    }
+    return (1);
+}
+
+/**
+ * graph_add_edge_between - Adds an edge between two resolved vertices
+ * With GRAPH_UNIQUE_EDGES, each direction is checked on its own and only
+ * the missing ones are linked. Float weights that are negative, infinite
+ * or NaN are rejected, the shortest path searches rely on them
+ * @graph: A pointer to the graph
+ * @src_vertex: The source vertex
+ * @dest_vertex: The destination vertex
+ * @weight: The weight of the edge, in both directions
+ * @type: The type of edge (UNIDIRECTIONAL or BIDIRECTIONAL)
+ *
+ * Return: 1 on success, 0 on failure, a rejected weight or if no direction
+ * was missing
+ */
+int graph_add_edge_between(graph_t *graph, vertex_t *src_vertex,
+                           vertex_t *dest_vertex, graph_weight_t weight,
+                           edge_type_t type)
+{
+    int unique, added = 0;
+
+#if defined(GRAPH_WEIGHT_FLOAT)
+    if (weight < 0 || !isfinite(weight))
+    {
+        return (0);
+    }
+#endif
+
+    unique = graph->flags & GRAPH_UNIQUE_EDGES;
+    if (!(unique && graph_edge_exists(graph, src_vertex, dest_vertex)))
+    {
+        if (!link_edge(graph, src_vertex, dest_vertex, weight))
+        {
+            return (0);
+        }
+        added = 1;
+    }
+
+    if (type == BIDIRECTIONAL &&
+        !(unique && graph_edge_exists(graph, dest_vertex, src_vertex)))
+    {
+        if (!link_edge(graph, dest_vertex, src_vertex, weight))
+        {
+            return (0);
+        }
+        added = 1;
+    }
+
+    return (added);
+}
+
 /**
  * graph_add_edge - Adds an edge between two vertices in the graph
+ * With GRAPH_UNIQUE_EDGES, an edge that already exists is rejected, and
+ * only the missing direction of a BIDIRECTIONAL edge is added. The edge
+ * weighs 1, see graph_add_weighted_edge
  * @graph: A pointer to the graph to add the edge to
  * @src: The string identifying the source vertex
  * @dest: The string identifying the destination vertex
  * @type: The type of edge (UNIDIRECTIONAL or BIDIRECTIONAL)
  * 
- * Return: 1 on success, 0 on failure
+ * Return: 1 on success, 0 on failure or if the edge is a rejected duplicate
  */
 int graph_add_edge(graph_t *graph, const char *src, const char *dest, edge_type_t type)
 {
     vertex_t *src_vertex;
     vertex_t *dest_vertex;
-    edge_t *new_edge;
-
-    src_vertex = graph_add_vertex(graph, src);
-    dest_vertex = graph_add_vertex(graph, dest);
 
-    if (!src_vertex || !dest_vertex)
+    if (!graph || !src || !dest)
     {
         return (0);
     }
 
-    new_edge = malloc(sizeof(edge_t));
-    if (!new_edge)
+    src_vertex = find_or_add_vertex(graph, src);
+    dest_vertex = find_or_add_vertex(graph, dest);
+
+    if (!src_vertex || !dest_vertex)
     {
         return (0);
     }
 
-    new_edge->dest = dest_vertex;
-    new_edge->next = src_vertex->edges;
-    src_vertex->edges = new_edge;
+    return (graph_add_edge_between(graph, src_vertex, dest_vertex, 1, type));
+}
 
-    if (type == BIDIRECTIONAL)
-    {
-        new_edge = malloc(sizeof(edge_t));
-        if (!new_edge)
-        {
-            return (0);
-        }
+/**
+ * graph_add_edge_id - Adds an edge between two vertices given by their IDs,
+ * see graph_add_edge
+ * @graph: A pointer to the graph to add the edge to
+ * @src: The ID of the source vertex
+ * @dest: The ID of the destination vertex
+ * @type: The type of edge (UNIDIRECTIONAL or BIDIRECTIONAL)
+ *
+ * Return: 1 on success, 0 on failure, unknown IDs or a rejected duplicate
+ */
+int graph_add_edge_id(graph_t *graph, vertex_id_t src, vertex_id_t dest,
+                      edge_type_t type)
+{
+    vertex_t *src_vertex;
+    vertex_t *dest_vertex;
+
+    src_vertex = graph_vertex_by_id(graph, src);
+    dest_vertex = graph_vertex_by_id(graph, dest);
 
-        new_edge->dest = src_vertex;
-        new_edge->next = dest_vertex->edges;
-        dest_vertex->edges = new_edge;
+    if (!src_vertex || !dest_vertex)
+    {
+        return (0);
     }
 
-    return (1);
+    return (graph_add_edge_between(graph, src_vertex, dest_vertex, 1, type));
 }
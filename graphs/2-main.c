@@ -0,0 +1,42 @@
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "graphs.h"
+
+void print_edges(graph_t const *graph)
+{
+    vertex_t const *vertex;
+    edge_t const *edge;
+
+    for (vertex = graph->vertices; vertex; vertex = vertex->next)
+    {
+        printf("%s:", vertex->content);
+        for (edge = vertex->edges; edge; edge = edge->next)
+            printf(" -> %s", edge->dest->content);
+        printf("\n");
+    }
+}
+
+int main(void)
+{
+    graph_t *graph;
+
+    graph = graph_create_flags(GRAPH_UNIQUE_EDGES);
+    if (!graph)
+    {
+        fprintf(stderr, "Failed to create graph\n");
+        return (EXIT_FAILURE);
+    }
+
+    printf("A -> B: %d\n", graph_add_edge(graph, "A", "B", UNIDIRECTIONAL));
+    printf("A <-> B: %d\n", graph_add_edge(graph, "A", "B", BIDIRECTIONAL));
+    printf("A <-> B again: %d\n",
+           graph_add_edge(graph, "A", "B", BIDIRECTIONAL));
+    printf("B -> A again: %d\n",
+           graph_add_edge(graph, "B", "A", UNIDIRECTIONAL));
+    print_edges(graph);
+
+    graph_delete(graph);
+
+    return (EXIT_SUCCESS);
+}
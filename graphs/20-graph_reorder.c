@@ -0,0 +1,164 @@
+#include <stdlib.h>
+#include "graphs.h"
+
+/**
+ * struct degree_key_s - Sort key of a vertex when ordering by degree
+ *
+ * @degree: Number of edges leaving the vertex
+ * @v: Index of the vertex
+ */
+typedef struct degree_key_s
+{
+	size_t degree;
+	size_t v;
+} degree_key_t;
+
+/**
+ * cmp_degree - Orders sort keys by decreasing degree, then increasing index
+ * @a: Pointer to the first key
+ * @b: Pointer to the second key
+ *
+ * Return: A negative, zero or positive value, as qsort expects
+ */
+static int cmp_degree(const void *a, const void *b)
+{
+	const degree_key_t *x = a, *y = b;
+
+	if (x->degree != y->degree)
+		return (x->degree < y->degree ? 1 : -1);
+	return ((x->v > y->v) - (x->v < y->v));
+}
+
+/**
+ * sort_by_degree - Sorts vertex indices by decreasing or increasing degree
+ * @csr: Snapshot the vertices belong to
+ * @items: Array of vertex indices to sort in place
+ * @n: Number of items
+ * @keys: Scratch array with room for @n keys
+ * @increasing: Whether to sort by increasing degree instead
+ */
+static void sort_by_degree(const graph_csr_t *csr, size_t *items, size_t n,
+			   degree_key_t *keys, int increasing)
+{
+	size_t i;
+
+	for (i = 0; i < n; i++)
+	{
+		keys[i].v = items[i];
+		keys[i].degree = csr->offsets[items[i] + 1] -
+			csr->offsets[items[i]];
+	}
+	qsort(keys, n, sizeof(*keys), cmp_degree);
+	for (i = 0; i < n; i++)
+		items[increasing ? n - 1 - i : i] = keys[i].v;
+}
+
+/**
+ * order_bfs - Lists the vertices of a snapshot in breadth-first order
+ * Every vertex not reached yet starts a new traversal, taken in index order,
+ * or by increasing degree in Cuthill-McKee mode. That mode also visits the
+ * new neighbours of a vertex by increasing degree, and reverses the result
+ * @csr: Pointer to the snapshot
+ * @order: Array of nb_vertices receiving the vertex indices in order
+ * @rcm: Whether to compute the reverse Cuthill-McKee order
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int order_bfs(const graph_csr_t *csr, size_t *order, int rcm)
+{
+	size_t n = csr->nb_vertices, *starts = NULL, i, s, head, tail = 0, e;
+	uint64_t *visited = calloc(BITSET_WORDS(n), sizeof(*visited));
+	degree_key_t *keys = malloc(n * sizeof(*keys));
+
+	if (rcm && keys && (starts = malloc(n * sizeof(*starts))))
+		for (i = 0; i < n; i++)
+			starts[i] = i;
+	if (!visited || !keys || (rcm && !starts))
+		tail = n + 1;
+	else if (rcm)
+		sort_by_degree(csr, starts, n, keys, 1);
+	for (i = 0; i < n && tail <= n; i++)
+	{
+		s = starts ? starts[i] : i;
+		if (BITSET_TEST(visited, s))
+			continue;
+		BITSET_SET(visited, s);
+		for (order[tail++] = s, head = tail - 1; head < tail; head++)
+		{
+			s = tail;
+			for (e = csr->offsets[order[head]];
+			     e < csr->offsets[order[head] + 1]; e++)
+				if (!BITSET_TEST(visited, csr->dests[e]))
+				{
+					BITSET_SET(visited, csr->dests[e]);
+					order[tail++] = csr->dests[e];
+				}
+			if (rcm)
+				sort_by_degree(csr, order + s, tail - s,
+					       keys, 1);
+		}
+	}
+	for (i = 0; rcm && tail == n && i < n / 2; i++)
+	{
+		s = order[i];
+		order[i] = order[n - 1 - i];
+		order[n - 1 - i] = s;
+	}
+	free(visited);
+	free(keys);
+	free(starts);
+	return (tail == n);
+}
+
+/**
+ * graph_reorder - Renumbers the vertices of a graph to improve locality
+ * Vertices, edges and names are then copied, in the new order, into fresh
+ * arena slabs: each vertex sits next to the following index and its edges
+ * are contiguous. The graph switches to GRAPH_ARENA mode, and every
+ * vertex_t pointer taken before the call becomes invalid. Tombstones are
+ * purged first, see graph_compact
+ * @graph: Pointer to the graph to reorder
+ * @strategy: Ordering to apply
+ *
+ * Return: Array of nb_vertices mapping an old index to the new one, to be
+ * freed by the caller, or NULL on failure (the graph is then unchanged)
+ */
+size_t *graph_reorder(graph_t *graph, graph_order_t strategy)
+{
+	graph_csr_t *csr;
+	size_t *order, *perm = NULL, i;
+	degree_key_t *keys = NULL;
+	int ok = 0;
+
+	if (!graph)
+		return (NULL);
+	graph_compact(graph);
+	if (!graph->nb_vertices)
+		return (NULL);
+	csr = graph_freeze(graph);
+	order = malloc(graph->nb_vertices * sizeof(*order));
+	if (csr && order && strategy == GRAPH_ORDER_DEGREE)
+	{
+		keys = malloc(csr->nb_vertices * sizeof(*keys));
+		for (i = 0; keys && i < csr->nb_vertices; i++)
+			order[i] = i;
+		if (keys)
+			sort_by_degree(csr, order, csr->nb_vertices, keys, 0);
+		ok = keys != NULL;
+	}
+	else if (csr && order && strategy <= GRAPH_ORDER_BFS)
+		ok = order_bfs(csr, order, strategy == GRAPH_ORDER_RCM);
+	if (ok)
+		perm = malloc(graph->nb_vertices * sizeof(*perm));
+	for (i = 0; perm && i < graph->nb_vertices; i++)
+		perm[order[i]] = i;
+	if (perm && !graph_relocate(graph, csr, order, perm))
+	{
+		free(perm);
+		perm = NULL;
+	}
+	graph_csr_delete(csr);
+	free(order);
+	free(keys);
+	return (perm);
+}
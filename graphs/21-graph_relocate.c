@@ -0,0 +1,89 @@
+#include <stdlib.h>
+#include <string.h>
+#include "graphs.h"
+
+/**
+ * relocate_vertex - Copies a vertex and its edges to their new place
+ * @graph: Graph the copies are allocated from
+ * @csr: Snapshot of the graph before the move
+ * @old: Index of the vertex before the move
+ * @vertex: New place of the vertex, next to the following index
+ * @edges: New place of its edges, in the same order as before
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int relocate_vertex(graph_t *graph, const graph_csr_t *csr,
+			   size_t old, vertex_t *vertex, edge_t *edges)
+{
+	const char *content = csr->vertices[old]->content;
+	size_t e, degree = csr->offsets[old + 1] - csr->offsets[old];
+
+	vertex->content = graph_strndup(graph, content, strlen(content));
+	if (!vertex->content)
+		return (0);
+	vertex->nb_edges = csr->vertices[old]->nb_edges;
+	vertex->edges = degree ? edges : NULL;
+	for (e = 0; e < degree; e++)
+		edges[e].next = e + 1 < degree ? &edges[e + 1] : NULL;
+	return (1);
+}
+
+/**
+ * graph_relocate - Rebuilds the storage of a graph in a new vertex order
+ * Vertices and edges are copied into two contiguous arena blocks, the old
+ * storage is freed and the hash indexes rebuilt
+ * @graph: Pointer to the graph to rebuild
+ * @csr: Snapshot of @graph
+ * @order: Array mapping a new vertex index to the old one
+ * @perm: Array mapping an old vertex index to the new one
+ *
+ * Return: 1 on success, 0 on failure (the graph is then unchanged)
+ */
+int graph_relocate(graph_t *graph, const graph_csr_t *csr,
+		   const size_t *order, const size_t *perm)
+{
+	graph_t old = *graph;
+	vertex_t *vertices;
+	edge_t *edges;
+	size_t n = csr->nb_vertices, i, e, pos = 0;
+	int ok;
+
+	graph->flags |= GRAPH_ARENA;
+	graph->slabs = NULL;
+	vertices = graph_alloc(graph, n * sizeof(*vertices));
+	edges = graph_alloc(graph, (csr->nb_edges ? csr->nb_edges : 1) *
+			    sizeof(*edges));
+	ok = vertices && edges;
+	for (i = 0; ok && i < n; i++)
+	{
+		vertices[i].index = i;
+		vertices[i].next = i + 1 < n ? &vertices[i + 1] : NULL;
+		ok = relocate_vertex(graph, csr, order[i], &vertices[i],
+				     &edges[pos]);
+		for (e = csr->offsets[order[i]];
+		     ok && e < csr->offsets[order[i] + 1]; e++)
+		{
+			edges[pos].weight = csr->weights ? csr->weights[e] : 1;
+			edges[pos++].dest = &vertices[perm[csr->dests[e]]];
+		}
+	}
+	if (ok)
+	{
+		graph->vertices = vertices;
+		graph->tail = &vertices[n - 1];
+		ok = graph_edge_index_rebuild(graph);
+	}
+	if (!ok)
+	{
+		graph->vertices = old.vertices;
+		graph->tail = old.tail;
+		graph_slabs_free(graph->slabs);
+		graph->slabs = old.slabs;
+		graph->flags = old.flags;
+		return (0);
+	}
+	graph_index_rebuild(graph);
+	graph_by_id_rebuild(graph);
+	graph_free_storage(&old);
+	return (1);
+}
@@ -0,0 +1,164 @@
+#include <stdlib.h>
+#include <string.h>
+#include "graphs.h"
+
+#define BFS_MS_WIDTH 64
+
+/**
+ * struct bfs_ms_s - State of a batch of up to 64 concurrent traversals
+ * Bit i of a word belongs to the i-th source of the batch
+ *
+ * @csr: Snapshot being traversed
+ * @depths: Array of one depth array per source of the batch
+ * @seen: Per vertex, the sources that already reached it
+ * @visit: Per vertex, the sources whose current level holds it
+ * @next: Per vertex, the sources whose next level holds it
+ */
+typedef struct bfs_ms_s
+{
+	const graph_csr_t *csr;
+	size_t **depths;
+	uint64_t *seen;
+	uint64_t *visit;
+	uint64_t *next;
+} bfs_ms_t;
+
+/**
+ * ms_step - Expands the current level of every traversal of a batch at once
+ * Each edge is scanned once for all the sources visiting its origin
+ * @bfs: Pointer to the batch state
+ * @depth: Depth of the level being discovered
+ *
+ * Return: 1 if any traversal reached new vertices, 0 otherwise
+ */
+static int ms_step(bfs_ms_t *bfs, size_t depth)
+{
+	const graph_csr_t *csr = bfs->csr;
+	size_t v, e;
+	uint64_t bits, *swap;
+	int reached = 0;
+
+	for (v = 0; v < csr->nb_vertices; v++)
+		if (bfs->visit[v])
+			for (e = csr->offsets[v]; e < csr->offsets[v + 1]; e++)
+				bfs->next[csr->dests[e]] |= bfs->visit[v];
+	for (v = 0; v < csr->nb_vertices; v++)
+	{
+		bits = bfs->next[v] & ~bfs->seen[v];
+		bfs->next[v] = bits;
+		bfs->seen[v] |= bits;
+		reached |= bits != 0;
+		for (; bits; bits &= bits - 1)
+			bfs->depths[__builtin_ctzll(bits)][v] = depth;
+	}
+	swap = bfs->visit;
+	bfs->visit = bfs->next;
+	bfs->next = swap;
+	memset(bfs->next, 0, csr->nb_vertices * sizeof(*bfs->next));
+	return (reached);
+}
+
+/**
+ * ms_batch - Runs the traversals of up to 64 sources together
+ * @bfs: Pointer to the batch state, with @depths already set
+ * @sources: Array of the indices of the sources of the batch
+ * @count: Number of sources in the batch
+ *
+ * Return: The maximum depth reached by the batch
+ */
+static size_t ms_batch(bfs_ms_t *bfs, const size_t *sources, size_t count)
+{
+	size_t n = bfs->csr->nb_vertices, i, depth = 0;
+
+	memset(bfs->seen, 0, n * sizeof(*bfs->seen));
+	memset(bfs->visit, 0, n * sizeof(*bfs->visit));
+	memset(bfs->next, 0, n * sizeof(*bfs->next));
+	for (i = 0; i < count; i++)
+	{
+		memset(bfs->depths[i], 0xff, n * sizeof(size_t));
+		bfs->depths[i][sources[i]] = 0;
+		bfs->seen[sources[i]] |= (uint64_t)1 << i;
+		bfs->visit[sources[i]] |= (uint64_t)1 << i;
+	}
+	while (ms_step(bfs, depth + 1))
+		depth++;
+	return (depth);
+}
+
+/**
+ * csr_breadth_first_traverse_ms - Traverses a CSR snapshot from many
+ * sources at once, using a bit-parallel multi-source BFS
+ * Sources are processed in batches of 64, each batch sharing one pass over
+ * the edges per level, with one bit per source in a word per vertex
+ * @csr: Pointer to the snapshot to traverse
+ * @sources: Array of the indices of the start vertices
+ * @nb_sources: Number of start vertices
+ * @depths: Array of @nb_sources arrays of nb_vertices, receiving the depth
+ * of each vertex from the matching source, or SIZE_MAX for vertices it does
+ * not reach
+ *
+ * Return: The maximum depth reached from any source, or 0 on failure
+ */
+size_t csr_breadth_first_traverse_ms(const graph_csr_t *csr,
+	const size_t *sources, size_t nb_sources, size_t **depths)
+{
+	bfs_ms_t bfs;
+	size_t i, n, depth, max_depth = 0;
+
+	if (!csr || !sources || !depths || !csr->nb_vertices)
+		return (0);
+	for (i = 0; i < nb_sources; i++)
+		if (sources[i] >= csr->nb_vertices || !depths[i])
+			return (0);
+	n = csr->nb_vertices;
+	bfs.csr = csr;
+	bfs.seen = malloc(n * sizeof(*bfs.seen));
+	bfs.visit = malloc(n * sizeof(*bfs.visit));
+	bfs.next = malloc(n * sizeof(*bfs.next));
+	for (i = 0; bfs.seen && bfs.visit && bfs.next && i < nb_sources;
+	     i += BFS_MS_WIDTH)
+	{
+		bfs.depths = depths + i;
+		depth = ms_batch(&bfs, sources + i,
+				 nb_sources - i < BFS_MS_WIDTH ?
+				 nb_sources - i : BFS_MS_WIDTH);
+		if (depth > max_depth)
+			max_depth = depth;
+	}
+	free(bfs.seen);
+	free(bfs.visit);
+	free(bfs.next);
+	return (max_depth);
+}
+
+/**
+ * breadth_first_traverse_ms - Traverses a graph from many sources at once,
+ * see csr_breadth_first_traverse_ms
+ * @graph: Pointer to the graph to traverse
+ * @sources: Array of the start vertices
+ * @nb_sources: Number of start vertices
+ * @depths: Array of @nb_sources arrays of nb_vertices, receiving the depth
+ * of each vertex from the matching source, indexed by vertex_t.index
+ *
+ * Return: The maximum depth reached from any source, or 0 on failure
+ */
+size_t breadth_first_traverse_ms(const graph_t *graph,
+	const vertex_t * const *sources, size_t nb_sources, size_t **depths)
+{
+	graph_csr_t *csr;
+	size_t *indices, i, max_depth = 0;
+
+	if (!graph || !sources)
+		return (0);
+	indices = malloc((nb_sources ? nb_sources : 1) * sizeof(*indices));
+	if (!indices)
+		return (0);
+	for (i = 0; i < nb_sources && sources[i]; i++)
+		indices[i] = sources[i]->index;
+	csr = i == nb_sources ? graph_freeze(graph) : NULL;
+	max_depth = csr_breadth_first_traverse_ms(csr, indices, nb_sources,
+						  depths);
+	graph_csr_delete(csr);
+	free(indices);
+	return (max_depth);
+}
@@ -0,0 +1,138 @@
+#include <stdlib.h>
+#include <stdint.h>
+#include "graphs.h"
+
+#define GRAPH_EDGE_INDEX_MIN_BUCKETS 64
+
+/**
+ * graph_hash_edge - Hashes the endpoints of an edge
+ * @src: Source vertex of the edge
+ * @dest: Destination vertex of the edge
+ *
+ * Return: The hash value
+ */
+size_t graph_hash_edge(const vertex_t *src, const vertex_t *dest)
+{
+	uint64_t hash;
+
+	hash = (uint64_t)(uintptr_t)src * 0x9e3779b97f4a7c15ULL;
+	hash ^= (uint64_t)(uintptr_t)dest + (hash >> 29);
+	hash *= 0xbf58476d1ce4e5b9ULL;
+	return ((size_t)(hash ^ (hash >> 32)));
+}
+
+/**
+ * edge_place - Stores an edge in the first free slot of its probe chain
+ * @buckets: Edge index to store the edge in
+ * @nb_buckets: Size of @buckets (power of two)
+ * @src: Source vertex of the edge
+ * @dest: Destination vertex of the edge
+ */
+static void edge_place(graph_edge_slot_t *buckets, size_t nb_buckets,
+		       const vertex_t *src, const vertex_t *dest)
+{
+	size_t mask = nb_buckets - 1;
+	size_t slot;
+
+	slot = graph_hash_edge(src, dest) & mask;
+	while (buckets[slot].src)
+		slot = (slot + 1) & mask;
+	buckets[slot].src = src;
+	buckets[slot].dest = dest;
+}
+
+/**
+ * edge_reserve - Grows the edge index until it has room for more edges,
+ * keeping it at most 3/4 full
+ * @graph: Pointer to the graph owning the index
+ * @count: Number of edges about to be added
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int edge_reserve(graph_t *graph, size_t count)
+{
+	graph_edge_slot_t *buckets;
+	size_t nb_buckets, i;
+
+	nb_buckets = graph->nb_edge_buckets ? graph->nb_edge_buckets :
+		GRAPH_EDGE_INDEX_MIN_BUCKETS;
+	while ((graph->nb_indexed_edges + count) * 4 > nb_buckets * 3)
+		nb_buckets *= 2;
+	if (nb_buckets == graph->nb_edge_buckets)
+		return (1);
+	buckets = calloc(nb_buckets, sizeof(*buckets));
+	if (!buckets)
+		return (0);
+
+	for (i = 0; i < graph->nb_edge_buckets; i++)
+		if (graph->edge_buckets[i].src)
+			edge_place(buckets, nb_buckets,
+				   graph->edge_buckets[i].src,
+				   graph->edge_buckets[i].dest);
+
+	free(graph->edge_buckets);
+	graph->edge_buckets = buckets;
+	graph->nb_edge_buckets = nb_buckets;
+	return (1);
+}
+
+/**
+ * graph_edge_index_add - Indexes the edge just prepended to a vertex
+ * The vertex reaching GRAPH_EDGE_INDEX_MIN edges gets all of them indexed
+ * @graph: Pointer to the graph owning the index
+ * @src: Vertex the edge was added to, with nb_edges already counting it
+ *
+ * Return: 1 on success, 0 on failure (the index is then unchanged)
+ */
+int graph_edge_index_add(graph_t *graph, const vertex_t *src)
+{
+	const edge_t *edge;
+	size_t count;
+
+	if (src->nb_edges < GRAPH_EDGE_INDEX_MIN)
+		return (1);
+	count = src->nb_edges == GRAPH_EDGE_INDEX_MIN ? src->nb_edges : 1;
+	if (!edge_reserve(graph, count))
+		return (0);
+	for (edge = src->edges; count--; edge = edge->next)
+		edge_place(graph->edge_buckets, graph->nb_edge_buckets, src,
+			   edge->dest);
+	graph->nb_indexed_edges += src->nb_edges == GRAPH_EDGE_INDEX_MIN ?
+		src->nb_edges : 1;
+	return (1);
+}
+
+/**
+ * graph_edge_index_rebuild - Re-indexes every edge of a graph from scratch,
+ * after its edges were linked or moved in bulk
+ * @graph: Pointer to the graph owning the index
+ *
+ * Return: 1 on success, 0 on failure (the index is then unchanged)
+ */
+int graph_edge_index_rebuild(graph_t *graph)
+{
+	graph_t fresh;
+	const vertex_t *vertex;
+	const edge_t *edge;
+	size_t count = 0;
+
+	for (vertex = graph->vertices; vertex; vertex = vertex->next)
+		if (vertex->nb_edges >= GRAPH_EDGE_INDEX_MIN)
+			count += vertex->nb_edges;
+	fresh.edge_buckets = NULL;
+	fresh.nb_edge_buckets = 0;
+	fresh.nb_indexed_edges = 0;
+	if (count && !edge_reserve(&fresh, count))
+		return (0);
+	for (vertex = graph->vertices; vertex; vertex = vertex->next)
+		if (vertex->nb_edges >= GRAPH_EDGE_INDEX_MIN)
+			for (edge = vertex->edges; edge; edge = edge->next)
+				edge_place(fresh.edge_buckets,
+					   fresh.nb_edge_buckets, vertex,
+					   edge->dest);
+	free(graph->edge_buckets);
+	graph->edge_buckets = fresh.edge_buckets;
+	graph->nb_edge_buckets = fresh.nb_edge_buckets;
+	graph->nb_indexed_edges = count;
+	return (1);
+}
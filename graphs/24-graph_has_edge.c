@@ -0,0 +1,154 @@
+#include <stdlib.h>
+#include <string.h>
+#include "graphs.h"
+
+/**
+ * graph_edge_exists - Tells whether a graph has an edge between two vertices
+ * Edges of vertices with at least GRAPH_EDGE_INDEX_MIN edges are looked up
+ * in the edge index, short lists are scanned
+ * @graph: Pointer to the graph
+ * @src: Source vertex
+ * @dest: Destination vertex
+ *
+ * Return: 1 if the edge exists, 0 otherwise
+ */
+int graph_edge_exists(const graph_t *graph, const vertex_t *src,
+		      const vertex_t *dest)
+{
+	const edge_t *edge;
+	size_t mask, slot;
+
+	if (src->nb_edges < GRAPH_EDGE_INDEX_MIN)
+	{
+		for (edge = src->edges; edge; edge = edge->next)
+			if (edge->dest == dest)
+				return (1);
+		return (0);
+	}
+
+	mask = graph->nb_edge_buckets - 1;
+	slot = graph_hash_edge(src, dest) & mask;
+	while (graph->edge_buckets[slot].src)
+	{
+		if (graph->edge_buckets[slot].src == src &&
+		    graph->edge_buckets[slot].dest == dest)
+			return (1);
+		slot = (slot + 1) & mask;
+	}
+	return (0);
+}
+
+/**
+ * graph_has_edge - Tells whether a graph has an edge from a vertex to another
+ * Runs in constant expected time, whatever the degree of @src
+ * @graph: Pointer to the graph
+ * @src: String identifying the source vertex
+ * @dest: String identifying the destination vertex
+ *
+ * Return: 1 if the edge exists, 0 otherwise
+ */
+int graph_has_edge(const graph_t *graph, const char *src, const char *dest)
+{
+	const vertex_t *src_vertex, *dest_vertex;
+
+	src_vertex = graph_find_vertex(graph, src);
+	dest_vertex = graph_find_vertex(graph, dest);
+	if (!src_vertex || !dest_vertex)
+		return (0);
+	return (graph_edge_exists(graph, src_vertex, dest_vertex));
+}
+
+/**
+ * graph_drop_duplicate_edges - Removes repeated edges from every list of a
+ * graph, keeping the first edge to each destination
+ * The edge index must be rebuilt afterwards
+ * @graph: Pointer to the graph
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int graph_drop_duplicate_edges(graph_t *graph)
+{
+	size_t *seen;
+	vertex_t *vertex;
+	edge_t **link, *edge;
+
+	seen = malloc((graph->nb_vertices ? graph->nb_vertices : 1) *
+		      sizeof(*seen));
+	if (!seen)
+		return (0);
+	memset(seen, 0xff, graph->nb_vertices * sizeof(*seen));
+	for (vertex = graph->vertices; vertex; vertex = vertex->next)
+		for (link = &vertex->edges; (edge = *link);)
+		{
+			if (seen[edge->dest->index] != vertex->index)
+			{
+				seen[edge->dest->index] = vertex->index;
+				link = &edge->next;
+				continue;
+			}
+			*link = edge->next;
+			vertex->nb_edges--;
+			graph_free_item(graph, edge);
+		}
+	free(seen);
+	return (1);
+}
+
+/**
+ * edge_unplace - Removes an edge from the edge index
+ * The following entries of the probe chain are shifted back into the hole,
+ * so lookups never need tombstones
+ * @graph: Pointer to the graph owning the index
+ * @src: Source vertex of the edge
+ * @dest: Destination vertex of the edge
+ */
+static void edge_unplace(graph_t *graph, const vertex_t *src,
+			 const vertex_t *dest)
+{
+	graph_edge_slot_t *buckets = graph->edge_buckets;
+	size_t mask = graph->nb_edge_buckets - 1, hole, slot, home;
+
+	hole = graph_hash_edge(src, dest) & mask;
+	while (buckets[hole].src &&
+	       (buckets[hole].src != src || buckets[hole].dest != dest))
+		hole = (hole + 1) & mask;
+	if (!buckets[hole].src)
+		return;
+	for (slot = (hole + 1) & mask; buckets[slot].src;
+	     slot = (slot + 1) & mask)
+	{
+		home = graph_hash_edge(buckets[slot].src, buckets[slot].dest) &
+			mask;
+		/* Entries whose home is outside (hole, slot] move back */
+		if (((slot - home) & mask) >= ((slot - hole) & mask))
+		{
+			buckets[hole] = buckets[slot];
+			hole = slot;
+		}
+	}
+	buckets[hole].src = NULL;
+	graph->nb_indexed_edges--;
+}
+
+/**
+ * graph_edge_index_remove - Drops an edge just unlinked from a vertex from
+ * the edge index
+ * The vertex falling below GRAPH_EDGE_INDEX_MIN edges gets all of them
+ * dropped, as short lists are scanned instead
+ * @graph: Pointer to the graph owning the index
+ * @src: Vertex the edge was unlinked from, with nb_edges already updated
+ * @dest: Destination vertex of the edge
+ */
+void graph_edge_index_remove(graph_t *graph, const vertex_t *src,
+			     const vertex_t *dest)
+{
+	const edge_t *edge;
+
+	if (src->nb_edges + 1 < GRAPH_EDGE_INDEX_MIN)
+		return;
+	edge_unplace(graph, src, dest);
+	if (src->nb_edges + 1 > GRAPH_EDGE_INDEX_MIN)
+		return;
+	for (edge = src->edges; edge; edge = edge->next)
+		edge_unplace(graph, src, edge->dest);
+}
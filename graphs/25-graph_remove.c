@@ -0,0 +1,78 @@
+#include "graphs.h"
+
+/**
+ * unlink_edge - Unlinks and frees the first edge from a vertex to another
+ * @graph: Pointer to the graph
+ * @src: Vertex the edge leaves
+ * @dest: Vertex the edge leads to
+ *
+ * Return: 1 if an edge was removed, 0 if there was none
+ */
+static int unlink_edge(graph_t *graph, vertex_t *src, const vertex_t *dest)
+{
+	edge_t **link, *edge;
+
+	for (link = &src->edges; (edge = *link); link = &edge->next)
+		if (edge->dest == dest)
+		{
+			*link = edge->next;
+			src->nb_edges--;
+			graph_edge_index_remove(graph, src, dest);
+			graph_free_item(graph, edge);
+			return (1);
+		}
+	return (0);
+}
+
+/**
+ * graph_remove_edge - Removes an edge between two vertices of a graph
+ * Only the first matching edge goes when the graph holds duplicates
+ * @graph: Pointer to the graph
+ * @src: String identifying the source vertex
+ * @dest: String identifying the destination vertex
+ * @type: BIDIRECTIONAL to also remove the edge from @dest to @src
+ *
+ * Return: 1 if the edge from @src to @dest was removed, 0 otherwise
+ */
+int graph_remove_edge(graph_t *graph, const char *src, const char *dest,
+		      edge_type_t type)
+{
+	vertex_t *src_vertex, *dest_vertex;
+
+	src_vertex = graph_find_vertex(graph, src);
+	dest_vertex = graph_find_vertex(graph, dest);
+	if (!src_vertex || !dest_vertex ||
+	    !unlink_edge(graph, src_vertex, dest_vertex))
+		return (0);
+	if (type == BIDIRECTIONAL)
+		unlink_edge(graph, dest_vertex, src_vertex);
+	return (1);
+}
+
+/**
+ * graph_remove_vertex - Removes a vertex from a graph, leaving a tombstone
+ * The vertex leaves the name index and loses its own edges at once. Edges
+ * pointing to it are only skipped by traversals until graph_compact drops
+ * them, which is what keeps removal from scanning the whole graph. The
+ * vertex keeps its index, and snapshots show it as an isolated vertex with
+ * an empty name, until then
+ * @graph: Pointer to the graph
+ * @content: String identifying the vertex
+ *
+ * Return: 1 on success, 0 if the vertex does not exist
+ */
+int graph_remove_vertex(graph_t *graph, const char *content)
+{
+	vertex_t *vertex;
+
+	vertex = graph_find_vertex(graph, content);
+	if (!vertex)
+		return (0);
+	graph_index_remove(graph, vertex);
+	while (vertex->edges)
+		unlink_edge(graph, vertex, vertex->edges->dest);
+	graph_free_item(graph, vertex->content);
+	vertex->content = NULL;
+	graph->nb_removed++;
+	return (1);
+}
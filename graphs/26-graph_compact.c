@@ -0,0 +1,64 @@
+#include "graphs.h"
+
+/**
+ * drop_dead_edges - Unlinks the edges of a vertex leading to removed vertices
+ * @graph: Pointer to the graph
+ * @vertex: Vertex whose edges are checked
+ */
+static void drop_dead_edges(graph_t *graph, vertex_t *vertex)
+{
+	edge_t **link, *edge;
+
+	for (link = &vertex->edges; (edge = *link);)
+	{
+		if (!GRAPH_VERTEX_REMOVED(edge->dest))
+		{
+			link = &edge->next;
+			continue;
+		}
+		*link = edge->next;
+		vertex->nb_edges--;
+		graph_edge_index_remove(graph, vertex, edge->dest);
+		graph_free_item(graph, edge);
+	}
+}
+
+/**
+ * graph_compact - Purges the tombstones left by graph_remove_vertex
+ * Edges to removed vertices are dropped, removed vertices are unlinked and
+ * freed, and the others are renumbered densely, keeping their order. Live
+ * vertex_t pointers stay valid, but their index may change. A GRAPH_ARENA
+ * graph only gets its memory back through graph_reorder
+ * @graph: Pointer to the graph
+ *
+ * Return: The number of vertices purged
+ */
+size_t graph_compact(graph_t *graph)
+{
+	vertex_t **link, *vertex;
+	size_t index = 0, purged;
+
+	if (!graph || !graph->nb_removed)
+		return (0);
+
+	for (vertex = graph->vertices; vertex; vertex = vertex->next)
+		drop_dead_edges(graph, vertex);
+	graph->tail = NULL;
+	for (link = &graph->vertices; (vertex = *link);)
+	{
+		if (GRAPH_VERTEX_REMOVED(vertex))
+		{
+			*link = vertex->next;
+			graph_free_item(graph, vertex);
+			continue;
+		}
+		vertex->index = index++;
+		graph->tail = vertex;
+		link = &vertex->next;
+	}
+	purged = graph->nb_vertices - index;
+	graph->nb_vertices = index;
+	graph->nb_removed = 0;
+	graph_by_id_rebuild(graph);
+	return (purged);
+}
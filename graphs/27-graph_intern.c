@@ -0,0 +1,91 @@
+#include <stdlib.h>
+#include "graphs.h"
+
+#define GRAPH_BY_ID_MIN 16
+
+/**
+ * graph_by_id_reserve - Makes room in the ID table for one more vertex
+ * @graph: Pointer to the graph
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int graph_by_id_reserve(graph_t *graph)
+{
+	vertex_t **by_id;
+	size_t size;
+
+	if (graph->nb_vertices < graph->by_id_size)
+		return (1);
+	size = graph->by_id_size ? graph->by_id_size * 2 : GRAPH_BY_ID_MIN;
+	by_id = realloc(graph->by_id, size * sizeof(*by_id));
+	if (!by_id)
+		return (0);
+	graph->by_id = by_id;
+	graph->by_id_size = size;
+	return (1);
+}
+
+/**
+ * graph_by_id_rebuild - Refills the ID table after vertices were renumbered
+ * @graph: Pointer to the graph
+ */
+void graph_by_id_rebuild(graph_t *graph)
+{
+	vertex_t *vertex;
+
+	for (vertex = graph->vertices; vertex; vertex = vertex->next)
+		graph->by_id[vertex->index] = vertex;
+}
+
+/**
+ * graph_vertex_id - Looks up the ID of a vertex by its content
+ * IDs are the vertex indices, so they change with graph_compact and
+ * graph_reorder
+ * @graph: Pointer to the graph to search
+ * @content: String identifying the vertex
+ *
+ * Return: The ID of the vertex, or GRAPH_NO_ID if it is not in the graph
+ */
+vertex_id_t graph_vertex_id(const graph_t *graph, const char *content)
+{
+	const vertex_t *vertex;
+
+	vertex = graph_find_vertex(graph, content);
+	if (!vertex || vertex->index >= GRAPH_NO_ID)
+		return (GRAPH_NO_ID);
+	return ((vertex_id_t)vertex->index);
+}
+
+/**
+ * graph_intern - Gets the ID of a vertex, adding the vertex if needed
+ * This is the only step of the ID-based API that touches strings
+ * @graph: Pointer to the graph
+ * @content: String identifying the vertex
+ *
+ * Return: The ID of the vertex, or GRAPH_NO_ID on failure
+ */
+vertex_id_t graph_intern(graph_t *graph, const char *content)
+{
+	vertex_id_t id;
+
+	id = graph_vertex_id(graph, content);
+	if (id == GRAPH_NO_ID && graph && graph->nb_vertices < GRAPH_NO_ID &&
+	    graph_add_vertex(graph, content))
+		id = (vertex_id_t)(graph->nb_vertices - 1);
+	return (id);
+}
+
+/**
+ * graph_vertex_by_id - Gets a vertex from its ID in constant time
+ * @graph: Pointer to the graph
+ * @id: ID of the vertex
+ *
+ * Return: Pointer to the vertex, or NULL if @id is unknown or removed
+ */
+vertex_t *graph_vertex_by_id(const graph_t *graph, vertex_id_t id)
+{
+	if (!graph || id >= graph->nb_vertices ||
+	    GRAPH_VERTEX_REMOVED(graph->by_id[id]))
+		return (NULL);
+	return (graph->by_id[id]);
+}
@@ -0,0 +1,89 @@
+#include <stdlib.h>
+#include "graphs.h"
+
+/**
+ * depth_first_traverse_id - Traverses a graph depth-first from a vertex
+ * given by its ID, reporting IDs instead of vertices
+ * Vertices come in the same order, and at the same depths, as with a
+ * graph_dfs_iter_t started from @start
+ * @graph: Pointer to the graph to traverse
+ * @start: ID of the vertex to start from
+ * @action: Function to be called with the ID of each visited vertex
+ *
+ * Return: The maximum depth reached, or 0 on failure
+ */
+size_t depth_first_traverse_id(const graph_t *graph, vertex_id_t start,
+	void (*action)(vertex_id_t id, size_t depth))
+{
+	graph_dfs_iter_t *iter;
+	const vertex_t *vertex;
+	size_t depth, max_depth = 0;
+
+	vertex = graph_vertex_by_id(graph, start);
+	if (!vertex || !action)
+		return (0);
+
+	iter = graph_dfs_iter_create(graph, vertex);
+	if (!iter)
+		return (0);
+
+	while ((vertex = graph_dfs_iter_next(iter, &depth)))
+	{
+		action((vertex_id_t)vertex->index, depth);
+		if (depth > max_depth)
+			max_depth = depth;
+	}
+	if (iter->error)
+		max_depth = 0;
+	graph_dfs_iter_delete(iter);
+
+	return (max_depth);
+}
+
+/**
+ * breadth_first_traverse_id - Traverses a graph breadth-first from a vertex
+ * given by its ID, reporting IDs instead of vertices
+ * The queue is a flat array of vertices, each one entering it only once
+ * @graph: Pointer to the graph to traverse
+ * @start: ID of the vertex to start from
+ * @action: Function to be called with the ID of each visited vertex
+ *
+ * Return: The maximum depth reached, or 0 on failure
+ */
+size_t breadth_first_traverse_id(const graph_t *graph, vertex_id_t start,
+	void (*action)(vertex_id_t id, size_t depth))
+{
+	const vertex_t **queue;
+	const edge_t *edge;
+	uint64_t *visited;
+	size_t head = 0, tail = 0, level_end = 1, depth = 0;
+
+	if (!graph_vertex_by_id(graph, start) || !action)
+		return (0);
+	queue = malloc(graph->nb_vertices * sizeof(*queue));
+	visited = calloc(BITSET_WORDS(graph->nb_vertices), sizeof(*visited));
+	if (queue && visited)
+	{
+		queue[tail++] = graph->by_id[start];
+		BITSET_SET(visited, start);
+		for (; head < tail; head++)
+		{
+			if (head == level_end)
+			{
+				level_end = tail;
+				depth++;
+			}
+			action((vertex_id_t)queue[head]->index, depth);
+			for (edge = queue[head]->edges; edge; edge = edge->next)
+				if (!GRAPH_VERTEX_REMOVED(edge->dest) &&
+				    !BITSET_TEST(visited, edge->dest->index))
+				{
+					BITSET_SET(visited, edge->dest->index);
+					queue[tail++] = edge->dest;
+				}
+		}
+	}
+	free(queue);
+	free(visited);
+	return (depth);
+}
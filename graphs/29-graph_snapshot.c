@@ -0,0 +1,47 @@
+#include <stdlib.h>
+#include <string.h>
+#include "graphs.h"
+
+/**
+ * graph_snapshot - Builds a CSR snapshot of a graph that owns a copy of the
+ * vertex names
+ * Unlike graph_freeze, the snapshot keeps no pointer into the graph, so it
+ * stays valid while the graph is modified or deleted. Traversal actions get
+ * a stub vertex, as with graph_open_mapped
+ * @graph: Pointer to the graph
+ *
+ * Return: Pointer to the snapshot, or NULL on failure
+ */
+graph_csr_t *graph_snapshot(const graph_t *graph)
+{
+	graph_csr_t *csr;
+	size_t v, size = 0, len;
+	size_t *names;
+	char *strings;
+
+	csr = graph_freeze(graph);
+	if (!csr)
+		return (NULL);
+	for (v = 0; v < csr->nb_vertices; v++)
+		size += strlen(graph_csr_content(csr, v)) + 1;
+	csr->pool = malloc(csr->nb_vertices * sizeof(*names) + size);
+	if (!csr->pool)
+	{
+		graph_csr_delete(csr);
+		return (NULL);
+	}
+	names = csr->pool;
+	strings = (char *)(names + csr->nb_vertices);
+	for (v = 0, size = 0; v < csr->nb_vertices; v++)
+	{
+		len = strlen(graph_csr_content(csr, v)) + 1;
+		memcpy(strings + size, graph_csr_content(csr, v), len);
+		names[v] = size;
+		size += len;
+	}
+	free(csr->vertices);
+	csr->vertices = NULL;
+	csr->names = names;
+	csr->strings = strings;
+	return (csr);
+}
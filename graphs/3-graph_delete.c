@@ -18,15 +18,21 @@ void free_edges(edge_t *edges)
 }
 
 /**
- * graph_delete - Deletes an entire graph, freeing all memory
- * @graph: Pointer to the graph to delete
+ * graph_free_storage - Frees the vertices, edges and strings of a graph,
+ * leaving the graph_t itself and its hash index untouched
+ * @graph: Pointer to the graph
  */
-void graph_delete(graph_t *graph)
+void graph_free_storage(graph_t *graph)
 {
 	vertex_t *temp_vertex;
 
-	if (!graph)
-		return;
+	if (graph->flags & GRAPH_ARENA)
+	{
+		/* Vertices, edges and strings all live in the slabs */
+		graph_slabs_free(graph->slabs);
+		graph->slabs = NULL;
+		graph->vertices = NULL;
+	}
 
 	while (graph->vertices)
 	{
@@ -37,6 +43,21 @@ void graph_delete(graph_t *graph)
 		free(temp_vertex->content);
 		free(temp_vertex);
 	}
+	graph->tail = NULL;
+}
+
+/**
+ * graph_delete - Deletes an entire graph, freeing all memory
+ * @graph: Pointer to the graph to delete
+ */
+void graph_delete(graph_t *graph)
+{
+	if (!graph)
+		return;
 
+	graph_free_storage(graph);
+	free(graph->buckets);
+	free(graph->edge_buckets);
+	free(graph->by_id);
 	free(graph);
 }
@@ -0,0 +1,145 @@
+#include <stdlib.h>
+#include "graphs.h"
+
+/**
+ * graph_publisher_create - Creates a publisher with no snapshot yet
+ * @nb_readers: Number of reader threads, each one using its own slot
+ *
+ * Return: Pointer to the publisher, or NULL on failure
+ */
+graph_publisher_t *graph_publisher_create(size_t nb_readers)
+{
+	graph_publisher_t *pub;
+
+	pub = calloc(1, sizeof(*pub));
+	if (!pub)
+		return (NULL);
+	pub->readers = calloc(nb_readers ? nb_readers : 1,
+			      sizeof(*pub->readers));
+	if (!pub->readers || pthread_mutex_init(&pub->lock, NULL))
+	{
+		free(pub->readers);
+		free(pub);
+		return (NULL);
+	}
+	pub->nb_readers = nb_readers;
+	/* Epoch 0 marks an idle reader slot */
+	pub->epoch = 1;
+	return (pub);
+}
+
+/**
+ * graph_publisher_delete - Frees a publisher and all its snapshots
+ * No reader may hold a snapshot anymore
+ * @pub: Pointer to the publisher
+ */
+void graph_publisher_delete(graph_publisher_t *pub)
+{
+	size_t i;
+
+	if (!pub)
+		return;
+	for (i = 0; i < pub->nb_retired; i++)
+		graph_csr_delete(pub->retired[i].csr);
+	graph_csr_delete(pub->current);
+	pthread_mutex_destroy(&pub->lock);
+	free(pub->retired);
+	free(pub->readers);
+	free(pub);
+}
+
+/**
+ * reclaim - Frees the retired snapshots no reader can still hold
+ * A reader pins the epoch before loading the snapshot, so one that holds
+ * a snapshot retired at epoch E announced an epoch of at most E
+ * @pub: Pointer to the publisher, with @lock held
+ *
+ * Return: The number of snapshots freed
+ */
+static size_t reclaim(graph_publisher_t *pub)
+{
+	uint64_t oldest = UINT64_MAX, epoch;
+	size_t i, kept = 0;
+
+	for (i = 0; i < pub->nb_readers; i++)
+	{
+		epoch = __atomic_load_n(&pub->readers[i].epoch,
+					__ATOMIC_SEQ_CST);
+		if (epoch && epoch < oldest)
+			oldest = epoch;
+	}
+	for (i = 0; i < pub->nb_retired; i++)
+		if (pub->retired[i].epoch < oldest)
+			graph_csr_delete(pub->retired[i].csr);
+		else
+			pub->retired[kept++] = pub->retired[i];
+	i = pub->nb_retired - kept;
+	pub->nb_retired = kept;
+	return (i);
+}
+
+/**
+ * graph_reclaim - Frees the replaced snapshots readers are done with
+ * graph_publish already does it, this is for writers idle for a while
+ * @pub: Pointer to the publisher
+ *
+ * Return: The number of snapshots freed
+ */
+size_t graph_reclaim(graph_publisher_t *pub)
+{
+	size_t count;
+
+	if (!pub)
+		return (0);
+	pthread_mutex_lock(&pub->lock);
+	count = reclaim(pub);
+	pthread_mutex_unlock(&pub->lock);
+	return (count);
+}
+
+/**
+ * graph_publish - Publishes a new snapshot of a graph to the readers
+ * The writer owns @graph and changes it freely between publications.
+ * Readers keep the snapshot they pinned until they unpin it, and the one
+ * replaced is freed once no reader holds it anymore
+ * @pub: Pointer to the publisher
+ * @graph: Pointer to the graph, not accessed by readers
+ *
+ * Return: 1 on success, 0 on failure (the previous snapshot stays current)
+ */
+int graph_publish(graph_publisher_t *pub, const graph_t *graph)
+{
+	graph_csr_t *csr, *old;
+	graph_retired_t *retired;
+	size_t cap;
+
+	if (!pub)
+		return (0);
+	csr = graph_snapshot(graph);
+	if (!csr)
+		return (0);
+	pthread_mutex_lock(&pub->lock);
+	if (pub->nb_retired == pub->cap_retired)
+	{
+		cap = pub->cap_retired ? pub->cap_retired * 2 : 8;
+		retired = realloc(pub->retired, cap * sizeof(*retired));
+		if (!retired)
+		{
+			pthread_mutex_unlock(&pub->lock);
+			graph_csr_delete(csr);
+			return (0);
+		}
+		pub->retired = retired;
+		pub->cap_retired = cap;
+	}
+	old = __atomic_exchange_n(&pub->current, csr, __ATOMIC_SEQ_CST);
+	if (old)
+	{
+		pub->retired[pub->nb_retired].csr = old;
+		pub->retired[pub->nb_retired++].epoch =
+			__atomic_fetch_add(&pub->epoch, 1, __ATOMIC_SEQ_CST);
+	}
+	reclaim(pub);
+	pthread_mutex_unlock(&pub->lock);
+	return (1);
+}
@@ -0,0 +1,34 @@
+#include "graphs.h"
+
+/**
+ * graph_reader_pin - Gets the latest snapshot of a publisher and keeps it
+ * alive until graph_reader_unpin
+ * Takes no lock: the reader announces the current epoch in its own slot,
+ * then loads the snapshot, which writers will not free while the slot
+ * holds an epoch up to the one it was replaced at
+ * @pub: Pointer to the publisher
+ * @reader: Slot of the calling thread, below nb_readers, used by no
+ * other thread at the same time
+ *
+ * Return: Pointer to the snapshot, NULL if none was published yet. The
+ * reader must unpin it in both cases
+ */
+const graph_csr_t *graph_reader_pin(graph_publisher_t *pub, size_t reader)
+{
+	uint64_t epoch;
+
+	epoch = __atomic_load_n(&pub->epoch, __ATOMIC_SEQ_CST);
+	__atomic_store_n(&pub->readers[reader].epoch, epoch, __ATOMIC_SEQ_CST);
+	return (__atomic_load_n(&pub->current, __ATOMIC_SEQ_CST));
+}
+
+/**
+ * graph_reader_unpin - Releases the snapshot pinned by a reader
+ * The snapshot must not be used afterwards
+ * @pub: Pointer to the publisher
+ * @reader: Slot of the calling thread
+ */
+void graph_reader_unpin(graph_publisher_t *pub, size_t reader)
+{
+	__atomic_store_n(&pub->readers[reader].epoch, 0, __ATOMIC_RELEASE);
+}
@@ -0,0 +1,253 @@
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "graphs.h"
+
+/**
+ * struct pagerank_s - State shared by the threads computing PageRank
+ *
+ * @csr: Snapshot whose ranks are computed
+ * @rev: Reversed snapshot, giving the sources of the incoming edges
+ * @nb_live: Number of vertices that are not removed, sharing the jumps
+ * @damping: Probability of following an edge rather than jumping
+ * @tolerance: L1 distance between two iterations under which they stop
+ * @max_iterations: Maximum number of iterations
+ * @ranks: Ranks of the current iteration
+ * @next: Ranks being computed
+ * @contrib: Rank each vertex passes along each of its out-edges
+ * @partial: Per thread, rank of vertices without out-edge, then L1 change
+ * @nb_threads: Number of threads started
+ * @iterations: Number of iterations done
+ * @done: Whether the ranks converged or ran out of iterations
+ * @barrier: Barrier separating the phases of an iteration
+ * @start: Mutex held until @barrier is initialized for the threads started
+ */
+typedef struct pagerank_s
+{
+	const graph_csr_t *csr;
+	const graph_csr_t *rev;
+	size_t nb_live;
+	double damping;
+	double tolerance;
+	size_t max_iterations;
+	double *ranks;
+	double *next;
+	double *contrib;
+	double *partial;
+	size_t nb_threads;
+	size_t iterations;
+	int done;
+	pthread_barrier_t barrier;
+	pthread_mutex_t start;
+} pagerank_t;
+
+/**
+ * struct pagerank_worker_s - Argument of a PageRank thread
+ *
+ * @pr: Shared state
+ * @id: Index of the thread, from 0
+ */
+typedef struct pagerank_worker_s
+{
+	pagerank_t *pr;
+	size_t id;
+} pagerank_worker_t;
+
+/**
+ * pagerank_pull - Computes the next rank of a range of vertices, pulling
+ * contributions over their incoming edges
+ * Removed vertices keep a rank of 0, see graph_csr_removed
+ * @pr: Pointer to the shared state
+ * @from: First vertex of the range
+ * @to: Vertex past the last one of the range
+ * @dangling: Total rank of the vertices without out-edge, spread evenly
+ *
+ * Return: L1 distance between the current and next ranks of the range
+ */
+static double pagerank_pull(pagerank_t *pr, size_t from, size_t to,
+			    double dangling)
+{
+	const graph_csr_t *rev = pr->rev;
+	size_t n = pr->nb_live, e;
+	double sum, base, diff = 0;
+
+	base = (1 - pr->damping) / n + pr->damping * dangling / n;
+	for (; from < to; from++)
+	{
+		if (graph_csr_removed(pr->csr, from))
+		{
+			pr->next[from] = 0;
+			continue;
+		}
+		sum = 0;
+		for (e = rev->offsets[from]; e < rev->offsets[from + 1]; e++)
+			sum += pr->contrib[rev->dests[e]];
+		pr->next[from] = base + pr->damping * sum;
+		diff += pr->next[from] > pr->ranks[from] ?
+			pr->next[from] - pr->ranks[from] :
+			pr->ranks[from] - pr->next[from];
+	}
+	return (diff);
+}
+
+/**
+ * pagerank_thread - Body of every PageRank thread
+ * Each thread owns a static range of vertices. An iteration computes the
+ * contributions, then pulls them, then one thread checks convergence
+ * @arg: Pointer to the pagerank_worker_t of the thread
+ *
+ * Return: Always NULL
+ */
+static void *pagerank_thread(void *arg)
+{
+	pagerank_worker_t *worker = arg;
+	pagerank_t *pr = worker->pr;
+	const graph_csr_t *csr = pr->csr;
+	size_t n = csr->nb_vertices, from, to, v, degree, t;
+	double dangling, *swap;
+
+	pthread_mutex_lock(&pr->start);
+	pthread_mutex_unlock(&pr->start);
+	from = n * worker->id / pr->nb_threads;
+	to = n * (worker->id + 1) / pr->nb_threads;
+	while (!pr->done)
+	{
+		for (v = from, dangling = 0; v < to; v++)
+		{
+			degree = csr->offsets[v + 1] - csr->offsets[v];
+			pr->contrib[v] = degree ? pr->ranks[v] / degree : 0;
+			dangling += degree ? 0 : pr->ranks[v];
+		}
+		pr->partial[worker->id] = dangling;
+		pthread_barrier_wait(&pr->barrier);
+		for (t = 0, dangling = 0; t < pr->nb_threads; t++)
+			dangling += pr->partial[t];
+		pthread_barrier_wait(&pr->barrier);
+		pr->partial[worker->id] = pagerank_pull(pr, from, to, dangling);
+		if (pthread_barrier_wait(&pr->barrier) ==
+		    PTHREAD_BARRIER_SERIAL_THREAD)
+		{
+			for (t = 0, dangling = 0; t < pr->nb_threads; t++)
+				dangling += pr->partial[t];
+			swap = pr->ranks;
+			pr->ranks = pr->next;
+			pr->next = swap;
+			pr->iterations++;
+			pr->done = dangling < pr->tolerance ||
+				pr->iterations >= pr->max_iterations;
+		}
+		pthread_barrier_wait(&pr->barrier);
+	}
+	return (NULL);
+}
+
+/**
+ * csr_pagerank - Computes the PageRank of every vertex of a CSR snapshot
+ * Pull-based: each vertex sums the contributions of its in-neighbours, so
+ * threads never write to the same rank. The rank of vertices without
+ * out-edge is spread over all vertices that are not removed. Removed
+ * vertices, which keep their index, get a rank of 0
+ * @csr: Pointer to the snapshot
+ * @rev: Pointer to graph_csr_transpose(@csr)
+ * @nb_threads: Number of threads to use, 0 for one per online CPU
+ * @tolerance: L1 change between two iterations under which they stop
+ * @ranks: Array of nb_vertices receiving the ranks, which add up to 1
+ *
+ * Return: The number of iterations done, or 0 on failure
+ */
+size_t csr_pagerank(const graph_csr_t *csr, const graph_csr_t *rev,
+		    size_t nb_threads, double tolerance, double *ranks)
+{
+	pagerank_t pr;
+	pagerank_worker_t *workers;
+	pthread_t *threads;
+	size_t n, v, started = 1;
+
+	if (!csr || !rev || !ranks)
+		return (0);
+	for (v = 0, n = 0; v < csr->nb_vertices; v++)
+		n += !graph_csr_removed(csr, v);
+	if (!n)
+		return (0);
+	if (!nb_threads)
+		nb_threads = sysconf(_SC_NPROCESSORS_ONLN) > 0 ?
+			sysconf(_SC_NPROCESSORS_ONLN) : 1;
+	memset(&pr, 0, sizeof(pr));
+	pr.csr = csr;
+	pr.rev = rev;
+	pr.nb_live = n;
+	n = csr->nb_vertices;
+	pr.damping = GRAPH_PAGERANK_DAMPING;
+	pr.tolerance = tolerance;
+	pr.max_iterations = GRAPH_PAGERANK_MAX_ITERATIONS;
+	pr.ranks = ranks;
+	pr.next = malloc(n * sizeof(*pr.next));
+	pr.contrib = malloc(n * sizeof(*pr.contrib));
+	pr.partial = calloc(nb_threads, sizeof(*pr.partial));
+	workers = malloc(nb_threads * sizeof(*workers));
+	threads = malloc(nb_threads * sizeof(*threads));
+	if (pr.next && pr.contrib && pr.partial && workers && threads)
+	{
+		for (v = 0; v < n; v++)
+			ranks[v] = graph_csr_removed(csr, v) ? 0 :
+				1.0 / pr.nb_live;
+		/* Threads that fail to start shrink the partition */
+		pthread_mutex_init(&pr.start, NULL);
+		pthread_mutex_lock(&pr.start);
+		for (; started < nb_threads; started++)
+		{
+			workers[started].pr = &pr;
+			workers[started].id = started;
+			if (pthread_create(&threads[started], NULL,
+					   pagerank_thread, &workers[started]))
+				break;
+		}
+		pr.nb_threads = started;
+		pthread_barrier_init(&pr.barrier, NULL, started);
+		pthread_mutex_unlock(&pr.start);
+		workers[0].pr = &pr;
+		workers[0].id = 0;
+		pagerank_thread(&workers[0]);
+		while (--started)
+			pthread_join(threads[started], NULL);
+		pthread_barrier_destroy(&pr.barrier);
+		pthread_mutex_destroy(&pr.start);
+		/* After an odd number of swaps the result sits in the copy */
+		for (v = 0; pr.ranks != ranks && v < n; v++)
+			ranks[v] = pr.ranks[v];
+		if (pr.ranks != ranks)
+			pr.next = pr.ranks;
+	}
+	free(pr.next);
+	free(pr.contrib);
+	free(pr.partial);
+	free(workers);
+	free(threads);
+	return (pr.iterations);
+}
+
+/**
+ * graph_pagerank - Computes the PageRank of every vertex of a graph, see
+ * csr_pagerank
+ * @graph: Pointer to the graph
+ * @nb_threads: Number of threads to use, 0 for one per online CPU
+ * @tolerance: L1 change between two iterations under which they stop
+ * @ranks: Array of nb_vertices receiving the ranks, indexed by
+ * vertex_t.index
+ *
+ * Return: The number of iterations done, or 0 on failure
+ */
+size_t graph_pagerank(const graph_t *graph, size_t nb_threads,
+		      double tolerance, double *ranks)
+{
+	graph_csr_t *csr, *rev;
+	size_t iterations;
+
+	csr = graph_freeze(graph);
+	rev = graph_csr_transpose(csr);
+	iterations = csr_pagerank(csr, rev, nb_threads, tolerance, ranks);
+	graph_csr_delete(csr);
+	graph_csr_delete(rev);
+	return (iterations);
+}
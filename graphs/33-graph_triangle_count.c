@@ -0,0 +1,211 @@
+#include <stdlib.h>
+#include <stdint.h>
+#include "graphs.h"
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/**
+ * struct oriented_s - Adjacency of the undirected simple graph underlying
+ * a snapshot, each edge kept once from its lower-ranked endpoint
+ * Ranking by degree bounds every list by the square root of the number of
+ * edges, so no intersection is dominated by a hub
+ *
+ * @offsets: Array of nb_vertices + 1 offsets into @dests
+ * @dests: Array of sorted, unique higher-ranked neighbours
+ */
+typedef struct oriented_s
+{
+	size_t *offsets;
+	uint32_t *dests;
+} oriented_t;
+
+/**
+ * cmp_u32 - Orders 32-bit vertex numbers increasingly
+ * @a: Pointer to the first number
+ * @b: Pointer to the second number
+ *
+ * Return: A negative, zero or positive value, as qsort expects
+ */
+static int cmp_u32(const void *a, const void *b)
+{
+	uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+
+	return ((x > y) - (x < y));
+}
+
+/**
+ * orient - Builds the oriented adjacency of a snapshot, ignoring the
+ * direction of its edges, self-loops and repeated edges
+ * @csr: Pointer to the snapshot
+ * @rev: Pointer to its transpose, used for the undirected degrees
+ * @out: Oriented adjacency to fill in
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int orient(const graph_csr_t *csr, const graph_csr_t *rev,
+		  oriented_t *out)
+{
+	size_t n = csr->nb_vertices, *deg, *pos, u, v, e, i, k;
+
+	deg = malloc(n * sizeof(*deg));
+	pos = calloc(n + 1, sizeof(*pos));
+	out->offsets = calloc(n + 1, sizeof(*out->offsets));
+	out->dests = malloc((csr->nb_edges ? csr->nb_edges : 1) *
+			    sizeof(*out->dests));
+	if (!deg || !pos || !out->offsets || !out->dests)
+	{
+		free(deg);
+		free(pos);
+		return (0);
+	}
+	for (u = 0; u < n; u++)
+		deg[u] = csr->offsets[u + 1] - csr->offsets[u] +
+			rev->offsets[u + 1] - rev->offsets[u];
+/* Whether the edge from u to v is kept, v ranking above u */
+#define RANKS_ABOVE(v, u) (deg[v] > deg[u] || (deg[v] == deg[u] && (v) > (u)))
+	for (u = 0; u < n; u++)
+		for (e = csr->offsets[u]; e < csr->offsets[u + 1]; e++)
+			if (csr->dests[e] != u)
+				pos[(RANKS_ABOVE(csr->dests[e], u) ? u :
+				     csr->dests[e]) + 1]++;
+	for (u = 0; u < n; u++)
+		pos[u + 1] += pos[u];
+	for (u = 0; u < n; u++)
+		for (e = csr->offsets[u]; e < csr->offsets[u + 1]; e++)
+		{
+			v = csr->dests[e];
+			if (v == u)
+				continue;
+			if (RANKS_ABOVE(v, u))
+				out->dests[pos[u]++] = (uint32_t)v;
+			else
+				out->dests[pos[v]++] = (uint32_t)u;
+		}
+#undef RANKS_ABOVE
+	/* Each pos[u] now ends its list, sort and deduplicate in place */
+	for (u = 0, i = 0, k = 0; u < n; u++)
+	{
+		qsort(out->dests + i, pos[u] - i, sizeof(uint32_t), cmp_u32);
+		out->offsets[u] = k;
+		for (; i < pos[u]; i++)
+			if (k == out->offsets[u] ||
+			    out->dests[k - 1] != out->dests[i])
+				out->dests[k++] = out->dests[i];
+	}
+	out->offsets[n] = k;
+	free(deg);
+	free(pos);
+	return (1);
+}
+
+/**
+ * intersect_count - Counts the values two sorted sets have in common
+ * With SSE2, blocks of 4 values are compared against all 4 rotations of
+ * the other block, then the block with the smaller maximum is consumed
+ * @a: First set
+ * @na: Number of values in @a
+ * @b: Second set
+ * @nb: Number of values in @b
+ *
+ * Return: The size of the intersection
+ */
+static size_t intersect_count(const uint32_t *a, size_t na,
+			      const uint32_t *b, size_t nb)
+{
+	size_t i = 0, j = 0, count = 0;
+#ifdef __SSE2__
+	__m128i va, vb, eq;
+	int mask;
+
+	while (i + 4 <= na && j + 4 <= nb)
+	{
+		va = _mm_loadu_si128((const __m128i *)(a + i));
+		vb = _mm_loadu_si128((const __m128i *)(b + j));
+		eq = _mm_cmpeq_epi32(va, vb);
+		vb = _mm_shuffle_epi32(vb, 0x39);
+		eq = _mm_or_si128(eq, _mm_cmpeq_epi32(va, vb));
+		vb = _mm_shuffle_epi32(vb, 0x39);
+		eq = _mm_or_si128(eq, _mm_cmpeq_epi32(va, vb));
+		vb = _mm_shuffle_epi32(vb, 0x39);
+		eq = _mm_or_si128(eq, _mm_cmpeq_epi32(va, vb));
+		mask = _mm_movemask_ps(_mm_castsi128_ps(eq));
+		count += __builtin_popcount(mask);
+		if (a[i + 3] <= b[j + 3])
+			i += 4;
+		else
+			j += 4;
+	}
+#endif
+	while (i < na && j < nb)
+	{
+		if (a[i] < b[j])
+			i++;
+		else if (a[i] > b[j])
+			j++;
+		else
+		{
+			count++;
+			i++;
+			j++;
+		}
+	}
+	return (count);
+}
+
+/**
+ * csr_triangle_count - Counts the triangles of a CSR snapshot, ignoring the
+ * direction of its edges
+ * Every edge (u, v) of the degree-oriented graph adds the number of
+ * neighbours u and v have in common, so each triangle is counted once
+ * @csr: Pointer to the snapshot, of less than 2^32 vertices
+ *
+ * Return: The number of triangles, or SIZE_MAX on failure
+ */
+size_t csr_triangle_count(const graph_csr_t *csr)
+{
+	graph_csr_t *rev;
+	oriented_t out = {NULL, NULL};
+	size_t u, e, v, count = SIZE_MAX;
+	const uint32_t *nu;
+
+	if (!csr || csr->nb_vertices > UINT32_MAX)
+		return (SIZE_MAX);
+	rev = graph_csr_transpose(csr);
+	if (rev && orient(csr, rev, &out))
+	{
+		count = 0;
+		for (u = 0; u < csr->nb_vertices; u++)
+			for (e = out.offsets[u]; e < out.offsets[u + 1]; e++)
+			{
+				v = out.dests[e];
+				nu = out.dests + out.offsets[u];
+				count += intersect_count(nu,
+					out.offsets[u + 1] - out.offsets[u],
+					out.dests + out.offsets[v],
+					out.offsets[v + 1] - out.offsets[v]);
+			}
+	}
+	graph_csr_delete(rev);
+	free(out.offsets);
+	free(out.dests);
+	return (count);
+}
+
+/**
+ * graph_triangle_count - Counts the triangles of a graph, see
+ * csr_triangle_count
+ * @graph: Pointer to the graph
+ *
+ * Return: The number of triangles, or SIZE_MAX on failure
+ */
+size_t graph_triangle_count(const graph_t *graph)
+{
+	graph_csr_t *csr;
+	size_t count;
+
+	csr = graph_freeze(graph);
+	count = csr ? csr_triangle_count(csr) : SIZE_MAX;
+	graph_csr_delete(csr);
+	return (count);
+}
@@ -0,0 +1,169 @@
+#include <stdlib.h>
+#include <string.h>
+#include "graphs.h"
+
+/**
+ * cmp_size - Orders vertex indices increasingly
+ * @a: Pointer to the first index
+ * @b: Pointer to the second index
+ *
+ * Return: A negative, zero or positive value, as qsort expects
+ */
+static int cmp_size(const void *a, const void *b)
+{
+	size_t x = *(const size_t *)a, y = *(const size_t *)b;
+
+	return ((x > y) - (x < y));
+}
+
+/**
+ * pack_names - Copies the vertices of a snapshot, or its names when it has
+ * no vertices, so the compressed snapshot does not depend on it
+ * @packed: Pointer to the compressed snapshot
+ * @csr: Pointer to the snapshot it is packed from
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int pack_names(graph_packed_t *packed, const graph_csr_t *csr)
+{
+	size_t v, size = 0, len;
+
+	if (csr->vertices)
+	{
+		packed->vertices = malloc((csr->nb_vertices ? csr->nb_vertices :
+					   1) * sizeof(*packed->vertices));
+		if (!packed->vertices)
+			return (0);
+		memcpy(packed->vertices, csr->vertices,
+		       csr->nb_vertices * sizeof(*packed->vertices));
+		return (1);
+	}
+	for (v = 0; v < csr->nb_vertices; v++)
+		size += strlen(graph_csr_content(csr, v)) + 1;
+	packed->names = malloc(csr->nb_vertices * sizeof(*packed->names) + 1);
+	packed->strings = malloc(size + 1);
+	if (!packed->names || !packed->strings)
+		return (0);
+	for (v = 0, size = 0; v < csr->nb_vertices; v++)
+	{
+		len = strlen(graph_csr_content(csr, v)) + 1;
+		memcpy(packed->strings + size, graph_csr_content(csr, v), len);
+		packed->names[v] = size;
+		size += len;
+	}
+	return (1);
+}
+
+/**
+ * pack_lists - Encodes the sorted adjacency lists of a snapshot
+ * Each list is its degree followed by its neighbours, the first one
+ * relative to the vertex and the others to their predecessor, every value
+ * as a LEB128 varint
+ * @packed: Pointer to the compressed snapshot, with room for its offsets
+ * @csr: Pointer to the snapshot it is packed from
+ * @sorted: Buffer with room for the largest adjacency list
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int pack_lists(graph_packed_t *packed, const graph_csr_t *csr,
+		      size_t *sorted)
+{
+	size_t v, e, x, deg, size = 0, cap = 0;
+	const size_t *dests;
+	unsigned char *bytes;
+
+	for (v = 0; v < csr->nb_vertices; v++)
+	{
+		deg = csr->offsets[v + 1] - csr->offsets[v];
+		dests = csr->dests + csr->offsets[v];
+		/* A list never takes more than one varint per edge, plus one */
+		if (cap - size < (deg + 1) * GRAPH_VARINT_MAX)
+		{
+			cap = 2 * (cap + (deg + 1) * GRAPH_VARINT_MAX);
+			bytes = realloc(packed->bytes, cap);
+			if (!bytes)
+				return (0);
+			packed->bytes = bytes;
+		}
+		memcpy(sorted, dests, deg * sizeof(*sorted));
+		qsort(sorted, deg, sizeof(*sorted), cmp_size);
+		packed->offsets[v] = size;
+		for (e = 0; e <= deg; e++)
+		{
+			if (!e)
+				x = deg;
+			else if (e == 1)
+				x = ZIGZAG((long)sorted[0] - (long)v);
+			else
+				x = sorted[e - 1] - sorted[e - 2];
+			for (; x >= 0x80; x >>= 7)
+				packed->bytes[size++] = (x & 0x7f) | 0x80;
+			packed->bytes[size++] = (unsigned char)x;
+		}
+	}
+	packed->offsets[csr->nb_vertices] = size;
+	bytes = realloc(packed->bytes, size ? size : 1);
+	if (bytes)
+		packed->bytes = bytes;
+	return (1);
+}
+
+/**
+ * graph_pack - Compresses the adjacency of a CSR snapshot, in the style of
+ * WebGraph
+ * Neighbours are sorted and stored as gaps between consecutive indices,
+ * so a list of nearby vertices takes about one byte per edge, against
+ * eight in a CSR snapshot and several dozen in the adjacency lists. Lists
+ * are decoded on the fly by graph_packed_next. The result shares the
+ * vertices of @csr, if any, so it must not outlive their graph, but it
+ * owns a copy of the names of a mapped or self-contained snapshot. Edge
+ * weights are not kept
+ * @csr: Pointer to the snapshot to compress
+ *
+ * Return: Pointer to the compressed snapshot, or NULL on failure
+ */
+graph_packed_t *graph_pack(const graph_csr_t *csr)
+{
+	graph_packed_t *packed;
+	size_t v, max_deg = 0, *sorted;
+
+	if (!csr)
+		return (NULL);
+	packed = calloc(1, sizeof(*packed));
+	if (!packed)
+		return (NULL);
+	packed->nb_vertices = csr->nb_vertices;
+	packed->nb_edges = csr->nb_edges;
+	for (v = 0; v < csr->nb_vertices; v++)
+		if (csr->offsets[v + 1] - csr->offsets[v] > max_deg)
+			max_deg = csr->offsets[v + 1] - csr->offsets[v];
+	packed->offsets = malloc((csr->nb_vertices + 1) *
+				 sizeof(*packed->offsets));
+	sorted = malloc((max_deg ? max_deg : 1) * sizeof(*sorted));
+	if (!packed->offsets || !sorted || !pack_names(packed, csr) ||
+	    !pack_lists(packed, csr, sorted))
+	{
+		free(sorted);
+		graph_packed_delete(packed);
+		return (NULL);
+	}
+	free(sorted);
+	return (packed);
+}
+
+/**
+ * graph_packed_delete - Frees a compressed snapshot
+ * The vertices it refers to belong to the graph and are left untouched
+ * @packed: Pointer to the compressed snapshot to free
+ */
+void graph_packed_delete(graph_packed_t *packed)
+{
+	if (!packed)
+		return;
+	free(packed->offsets);
+	free(packed->bytes);
+	free(packed->vertices);
+	free(packed->names);
+	free(packed->strings);
+	free(packed);
+}
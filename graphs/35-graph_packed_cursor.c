@@ -0,0 +1,122 @@
+#include "graphs.h"
+
+/**
+ * graph_packed_open - Starts decoding the adjacency list of a vertex
+ * @packed: Pointer to the compressed snapshot
+ * @v: Index of the vertex
+ * @cursor: Cursor to set at the first neighbour of @v
+ *
+ * Return: The degree of @v
+ */
+size_t graph_packed_open(const graph_packed_t *packed, size_t v,
+			 graph_packed_cursor_t *cursor)
+{
+	const unsigned char *p = packed->bytes + packed->offsets[v];
+	size_t deg, shift = 7;
+
+	deg = *p & 0x7f;
+	while (*p++ & 0x80)
+	{
+		deg |= (size_t)(*p & 0x7f) << shift;
+		shift += 7;
+	}
+	cursor->p = p;
+	cursor->left = deg;
+	cursor->first = 1;
+	cursor->prev = v;
+	return (deg);
+}
+
+/**
+ * graph_packed_next - Decodes the next neighbour of an adjacency list
+ * Most gaps fit in a single byte, which is decoded without looping
+ * @cursor: Cursor set by graph_packed_open
+ * @dest: Pointer receiving the index of the neighbour
+ *
+ * Return: 1 if a neighbour was decoded, 0 at the end of the list
+ */
+int graph_packed_next(graph_packed_cursor_t *cursor, size_t *dest)
+{
+	const unsigned char *p = cursor->p;
+	size_t x, shift = 7;
+
+	if (!cursor->left)
+		return (0);
+	x = *p & 0x7f;
+	while (*p++ & 0x80)
+	{
+		x |= (size_t)(*p & 0x7f) << shift;
+		shift += 7;
+	}
+	cursor->p = p;
+	cursor->left--;
+	if (cursor->first)
+	{
+		cursor->first = 0;
+		cursor->prev = (size_t)((long)cursor->prev + UNZIGZAG(x));
+	}
+	else
+		cursor->prev += x;
+	*dest = cursor->prev;
+	return (1);
+}
+
+/**
+ * graph_packed_neighbours - Decodes the whole adjacency list of a vertex
+ * @packed: Pointer to the compressed snapshot
+ * @v: Index of the vertex
+ * @dests: Array receiving the neighbours of @v by increasing index, or NULL
+ * to only get their number
+ *
+ * Return: The degree of @v
+ */
+size_t graph_packed_neighbours(const graph_packed_t *packed, size_t v,
+			       size_t *dests)
+{
+	graph_packed_cursor_t cursor;
+	size_t deg, i = 0;
+
+	deg = graph_packed_open(packed, v, &cursor);
+	if (dests)
+		while (graph_packed_next(&cursor, &dests[i]))
+			i++;
+	return (deg);
+}
+
+/**
+ * graph_packed_vertex - Gets the vertex to pass to a traversal action, see
+ * graph_csr_vertex
+ * @packed: Pointer to the compressed snapshot
+ * @v: Index of the vertex
+ * @stub: Vertex to fill in when the snapshot has no vertices
+ *
+ * Return: Pointer to the vertex, or to @stub
+ */
+const vertex_t *graph_packed_vertex(const graph_packed_t *packed, size_t v,
+				    vertex_t *stub)
+{
+	if (packed->vertices)
+		return (packed->vertices[v]);
+
+	stub->index = v;
+	stub->content = packed->strings + packed->names[v];
+	stub->nb_edges = graph_packed_neighbours(packed, v, NULL);
+	stub->edges = NULL;
+	stub->next = NULL;
+	return (stub);
+}
+
+/**
+ * graph_packed_size - Computes the memory taken by the adjacency of a
+ * compressed snapshot, vertex names excluded
+ * @packed: Pointer to the compressed snapshot
+ *
+ * Return: The size in bytes of its offsets and encoded lists
+ */
+size_t graph_packed_size(const graph_packed_t *packed)
+{
+	if (!packed)
+		return (0);
+	return ((packed->nb_vertices + 1) * sizeof(*packed->offsets) +
+		packed->offsets[packed->nb_vertices]);
+}
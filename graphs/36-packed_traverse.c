@@ -0,0 +1,145 @@
+#include <stdlib.h>
+#include "graphs.h"
+
+/**
+ * packed_first - Finds the vertex the traversals of a compressed snapshot
+ * start from, see graph_csr_first
+ * @packed: Pointer to the compressed snapshot
+ *
+ * Return: Index of the first vertex that is not removed, or nb_vertices if
+ * there is none
+ */
+static size_t packed_first(const graph_packed_t *packed)
+{
+	const vertex_t *vertex;
+	vertex_t stub;
+	size_t v;
+
+	for (v = 0; v < packed->nb_vertices; v++)
+	{
+		vertex = graph_packed_vertex(packed, v, &stub);
+		if (!GRAPH_VERTEX_REMOVED(vertex) && *vertex->content)
+			break;
+	}
+	return (v);
+}
+
+/**
+ * packed_depth_first_traverse - Traverses a compressed snapshot using
+ * depth-first search
+ * Like csr_depth_first_traverse, but every frame of the explicit stack
+ * keeps a cursor into the encoded list of its vertex, and neighbours are
+ * followed by increasing index rather than in the order of the edges list
+ * @packed: Pointer to the compressed snapshot, from its first vertex that
+ * is not removed
+ * @action: Function to be called for each visited vertex
+ *
+ * Return: The maximum depth reached, or 0 on failure
+ */
+size_t packed_depth_first_traverse(const graph_packed_t *packed,
+	void (*action)(const vertex_t *v, size_t depth))
+{
+	unsigned char *visited;
+	graph_packed_cursor_t *stack;
+	size_t top = 0, max_depth = 0, dest, start;
+	vertex_t stub;
+
+	if (!packed || !action)
+		return (0);
+	start = packed_first(packed);
+	if (start == packed->nb_vertices)
+		return (0);
+
+	visited = calloc(packed->nb_vertices, sizeof(*visited));
+	stack = malloc(packed->nb_vertices * sizeof(*stack));
+	if (!visited || !stack)
+	{
+		free(visited);
+		free(stack);
+		return (0);
+	}
+
+	visited[start] = 1;
+	action(graph_packed_vertex(packed, start, &stub), 0);
+	graph_packed_open(packed, start, &stack[0]);
+	while (1)
+	{
+		if (!graph_packed_next(&stack[top], &dest))
+		{
+			if (!top--)
+				break;
+			continue;
+		}
+		if (visited[dest])
+			continue;
+		visited[dest] = 1;
+		action(graph_packed_vertex(packed, dest, &stub), ++top);
+		if (top > max_depth)
+			max_depth = top;
+		graph_packed_open(packed, dest, &stack[top]);
+	}
+
+	free(visited);
+	free(stack);
+	return (max_depth);
+}
+
+/**
+ * packed_breadth_first_traverse - Traverses a compressed snapshot using BFS
+ * Like csr_breadth_first_traverse, but each list is decoded as it is
+ * scanned, and neighbours are enqueued by increasing index
+ * @packed: Pointer to the compressed snapshot, from its first vertex that
+ * is not removed
+ * @action: Function to be called for each visited vertex
+ *
+ * Return: The maximum depth reached, or 0 on failure
+ */
+size_t packed_breadth_first_traverse(const graph_packed_t *packed,
+	void (*action)(const vertex_t *v, size_t depth))
+{
+	unsigned char *visited;
+	size_t *queue, *depth, head = 0, tail = 0, max_depth = 0, v, dest;
+	graph_packed_cursor_t cursor;
+	vertex_t stub;
+
+	if (!packed || !action)
+		return (0);
+	v = packed_first(packed);
+	if (v == packed->nb_vertices)
+		return (0);
+
+	visited = calloc(packed->nb_vertices, sizeof(*visited));
+	queue = malloc(packed->nb_vertices * sizeof(*queue));
+	depth = malloc(packed->nb_vertices * sizeof(*depth));
+	if (!visited || !queue || !depth)
+	{
+		free(visited);
+		free(queue);
+		free(depth);
+		return (0);
+	}
+
+	visited[v] = 1;
+	depth[v] = 0;
+	queue[tail++] = v;
+	while (head < tail)
+	{
+		v = queue[head++];
+		action(graph_packed_vertex(packed, v, &stub), depth[v]);
+		max_depth = depth[v];
+		graph_packed_open(packed, v, &cursor);
+		while (graph_packed_next(&cursor, &dest))
+		{
+			if (visited[dest])
+				continue;
+			visited[dest] = 1;
+			depth[dest] = depth[v] + 1;
+			queue[tail++] = dest;
+		}
+	}
+
+	free(visited);
+	free(queue);
+	free(depth);
+	return (max_depth);
+}
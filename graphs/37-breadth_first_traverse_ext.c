@@ -0,0 +1,219 @@
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "graphs.h"
+
+/**
+ * struct bfs_ext_s - State of a semi-external BFS
+ * Only the bitsets and the partition counters live in memory, the
+ * adjacency is read from the mapped file one partition at a time
+ *
+ * @csr: Snapshot mapped from the file
+ * @bounds: Array of nb_parts + 1 vertex indices, partition p holds the
+ *   vertices bounds[p] .. bounds[p + 1] - 1, whose edges are contiguous
+ * @nb_parts: Number of partitions
+ * @visited: Bitset of vertices already reached
+ * @frontier: Bitset of the vertices of the current level
+ * @next: Bitset of the vertices of the next level
+ * @counts: Number of vertices of the current level in each partition
+ * @next_counts: Number of vertices of the next level in each partition
+ * @nb_next: Number of vertices in the next level
+ */
+typedef struct bfs_ext_s
+{
+	graph_csr_t *csr;
+	size_t *bounds;
+	size_t nb_parts;
+	uint64_t *visited;
+	uint64_t *frontier;
+	uint64_t *next;
+	size_t *counts;
+	size_t *next_counts;
+	size_t nb_next;
+} bfs_ext_t;
+
+/**
+ * partition - Splits the vertices into ranges whose edges span at most a
+ * segment, a single vertex may exceed it
+ * @ext: Pointer to the BFS state
+ * @segment: Maximum number of edges per partition
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int partition(bfs_ext_t *ext, size_t segment)
+{
+	const size_t *offsets = ext->csr->offsets;
+	size_t n = ext->csr->nb_vertices, lo = 0, hi, *bounds;
+
+	ext->bounds = malloc((n + 1) * sizeof(*ext->bounds));
+	if (!ext->bounds)
+		return (0);
+	while (lo < n)
+	{
+		ext->bounds[ext->nb_parts++] = lo;
+		hi = lo + 1;
+		while (hi < n && offsets[hi + 1] - offsets[lo] <= segment)
+			hi++;
+		lo = hi;
+	}
+	ext->bounds[ext->nb_parts] = n;
+	bounds = realloc(ext->bounds, (ext->nb_parts + 1) * sizeof(*bounds));
+	if (bounds)
+		ext->bounds = bounds;
+	ext->counts = calloc(ext->nb_parts, sizeof(*ext->counts));
+	ext->next_counts = calloc(ext->nb_parts, sizeof(*ext->next_counts));
+	return (ext->counts && ext->next_counts);
+}
+
+/**
+ * reach - Marks a vertex as reached and adds it to the next level
+ * @ext: Pointer to the BFS state
+ * @v: Index of the vertex
+ */
+static void reach(bfs_ext_t *ext, size_t v)
+{
+	size_t lo = 0, hi = ext->nb_parts, mid;
+
+	BITSET_SET(ext->visited, v);
+	BITSET_SET(ext->next, v);
+	/* Find the last partition starting at or before v */
+	while (hi - lo > 1)
+	{
+		mid = lo + (hi - lo) / 2;
+		if (ext->bounds[mid] <= v)
+			lo = mid;
+		else
+			hi = mid;
+	}
+	ext->next_counts[lo]++;
+	ext->nb_next++;
+}
+
+/**
+ * advise - Tells the kernel how the edges of a partition are about to be
+ * used, so they are read ahead sequentially, then dropped once scanned
+ * @ext: Pointer to the BFS state
+ * @p: Index of the partition
+ * @advice: MADV_WILLNEED or MADV_DONTNEED
+ */
+static void advise(const bfs_ext_t *ext, size_t p, int advice)
+{
+	const graph_csr_t *csr = ext->csr;
+	uintptr_t page = sysconf(_SC_PAGESIZE), from, to;
+
+	from = (uintptr_t)(csr->dests + csr->offsets[ext->bounds[p]]);
+	to = (uintptr_t)(csr->dests + csr->offsets[ext->bounds[p + 1]]);
+	/* Dropping pages shared with a neighbouring partition is harmless */
+	from -= from % page;
+	to += (page - to % page) % page;
+	if (to > from)
+		madvise((void *)from, to - from, advice);
+}
+
+/**
+ * scan - Reports the vertices of the current level in a partition, by
+ * increasing index, and reaches their neighbours
+ * The frontier bits and counter of the partition are cleared on the way,
+ * so they are ready to hold the level after the next one
+ * @ext: Pointer to the BFS state
+ * @p: Index of the partition
+ * @depth: Depth of the current level
+ * @action: Function to be called for each visited vertex
+ */
+static void scan(bfs_ext_t *ext, size_t p, size_t depth,
+		 void (*action)(const vertex_t *v, size_t depth))
+{
+	const graph_csr_t *csr = ext->csr;
+	size_t v, e, w, lo = ext->bounds[p], hi = ext->bounds[p + 1];
+	uint64_t bits;
+	vertex_t stub;
+
+	advise(ext, p, MADV_WILLNEED);
+	for (w = lo / 64; w < BITSET_WORDS(hi); w++)
+	{
+		bits = ext->frontier[w];
+		if (w == lo / 64)
+			bits &= ~(uint64_t)0 << (lo % 64);
+		if (w == hi / 64)
+			bits &= ((uint64_t)1 << (hi % 64)) - 1;
+		ext->frontier[w] &= ~bits;
+		for (; bits; bits &= bits - 1)
+		{
+			v = w * 64 + __builtin_ctzll(bits);
+			action(graph_csr_vertex(csr, v, &stub), depth);
+			for (e = csr->offsets[v]; e < csr->offsets[v + 1]; e++)
+				if (!BITSET_TEST(ext->visited, csr->dests[e]))
+					reach(ext, csr->dests[e]);
+		}
+	}
+	ext->counts[p] = 0;
+	advise(ext, p, MADV_DONTNEED);
+}
+
+/**
+ * breadth_first_traverse_ext - Traverses a binary snapshot file using a
+ * semi-external BFS, for graphs whose edges do not fit in memory
+ * The file, saved by graph_save_binary, is mapped and split into
+ * partitions of contiguous edges. Each level is batched per partition and
+ * partitions holding frontier vertices are read in file order, so the
+ * edges are streamed sequentially and released once scanned. Only three
+ * bits per vertex and the partition table are kept in memory. Every vertex
+ * is reported at the same depth as with breadth_first_traverse, but by
+ * increasing index within its level
+ * @path: Path of the file, traversed from its first vertex that is not
+ * removed
+ * @segment: Number of edges per partition, 0 for GRAPH_EXT_SEGMENT
+ * @action: Function to be called for each visited vertex
+ *
+ * Return: The maximum depth reached, or 0 on failure
+ */
+size_t breadth_first_traverse_ext(const char *path, size_t segment,
+	void (*action)(const vertex_t *v, size_t depth))
+{
+	bfs_ext_t ext;
+	size_t depth = 0, p, words, *swap, start;
+	uint64_t *bits;
+
+	memset(&ext, 0, sizeof(ext));
+	ext.csr = action ? graph_open_mapped(path) : NULL;
+	start = ext.csr ? graph_csr_first(ext.csr) : 0;
+	if (!ext.csr || start == ext.csr->nb_vertices)
+	{
+		graph_csr_delete(ext.csr);
+		return (0);
+	}
+	words = BITSET_WORDS(ext.csr->nb_vertices);
+	ext.visited = calloc(words, sizeof(uint64_t));
+	ext.frontier = calloc(words, sizeof(uint64_t));
+	ext.next = calloc(words, sizeof(uint64_t));
+	if (ext.visited && ext.frontier && ext.next &&
+	    partition(&ext, segment ? segment : GRAPH_EXT_SEGMENT))
+	{
+		madvise(ext.csr->mapping, ext.csr->mapping_size,
+			MADV_SEQUENTIAL);
+		reach(&ext, start);
+		for (; ext.nb_next; depth++)
+		{
+			bits = ext.frontier;
+			ext.frontier = ext.next;
+			ext.next = bits;
+			swap = ext.counts;
+			ext.counts = ext.next_counts;
+			ext.next_counts = swap;
+			ext.nb_next = 0;
+			for (p = 0; p < ext.nb_parts; p++)
+				if (ext.counts[p])
+					scan(&ext, p, depth, action);
+		}
+		depth--;
+	}
+	free(ext.visited);
+	free(ext.frontier);
+	free(ext.next);
+	free(ext.bounds);
+	free(ext.counts);
+	free(ext.next_counts);
+	graph_csr_delete(ext.csr);
+	return (depth);
+}
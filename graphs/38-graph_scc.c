@@ -0,0 +1,160 @@
+#include <stdlib.h>
+#include <string.h>
+#include "graphs.h"
+
+/**
+ * struct scc_s - State of an iterative Tarjan search
+ * A vertex that has an order but no label yet is on @stack
+ *
+ * @csr: Snapshot being searched
+ * @labels: Array receiving the component of each vertex
+ * @order: Array of the discovery order of each vertex, SIZE_MAX if unseen
+ * @low: Array of the smallest order reachable from each vertex's subtree
+ * @stack: Tarjan stack of vertices not assigned to a component yet
+ * @calls: Explicit call stack of the depth-first search
+ * @cursors: Next edge to follow for each entry of @calls
+ * @nb_stack: Number of vertices on @stack
+ * @nb_calls: Number of entries on @calls
+ * @seen: Number of vertices discovered so far
+ * @count: Number of components found so far
+ */
+typedef struct scc_s
+{
+	const graph_csr_t *csr;
+	size_t *labels;
+	size_t *order;
+	size_t *low;
+	size_t *stack;
+	size_t *calls;
+	size_t *cursors;
+	size_t nb_stack;
+	size_t nb_calls;
+	size_t seen;
+	size_t count;
+} scc_t;
+
+/**
+ * scc_enter - Discovers a vertex and pushes it on both stacks
+ * @scc: Pointer to the search state
+ * @v: Index of the vertex
+ */
+static void scc_enter(scc_t *scc, size_t v)
+{
+	scc->order[v] = scc->low[v] = scc->seen++;
+	scc->stack[scc->nb_stack++] = v;
+	scc->calls[scc->nb_calls] = v;
+	scc->cursors[scc->nb_calls++] = scc->csr->offsets[v];
+}
+
+/**
+ * scc_leave - Returns from a vertex whose edges are all followed, popping
+ * its component if it is the root of one
+ * @scc: Pointer to the search state
+ * @v: Index of the vertex
+ */
+static void scc_leave(scc_t *scc, size_t v)
+{
+	size_t w = SIZE_MAX, parent;
+
+	scc->nb_calls--;
+	if (scc->low[v] == scc->order[v])
+	{
+		while (w != v)
+		{
+			w = scc->stack[--scc->nb_stack];
+			scc->labels[w] = scc->count;
+		}
+		scc->count++;
+	}
+	if (scc->nb_calls)
+	{
+		parent = scc->calls[scc->nb_calls - 1];
+		if (scc->low[v] < scc->low[parent])
+			scc->low[parent] = scc->low[v];
+	}
+}
+
+/**
+ * csr_strongly_connected_components - Labels the strongly connected
+ * components of a CSR snapshot
+ * Runs Tarjan's algorithm from every vertex not reached yet, with explicit
+ * stacks instead of recursion, so it handles graphs of any depth in
+ * linear time
+ * @csr: Pointer to the snapshot
+ * @labels: Array of nb_vertices receiving the component of each vertex.
+ * Components are numbered in topological order: every edge between two
+ * components goes from a lower label to a higher one
+ *
+ * Return: The number of components, or 0 on failure
+ */
+size_t csr_strongly_connected_components(const graph_csr_t *csr,
+					 size_t *labels)
+{
+	scc_t scc;
+	size_t n, s, v, w, *cursor, *buf;
+
+	if (!csr || !labels || !csr->nb_vertices)
+		return (0);
+	n = csr->nb_vertices;
+	memset(&scc, 0, sizeof(scc));
+	scc.csr = csr;
+	scc.labels = labels;
+	buf = malloc(5 * n * sizeof(*buf));
+	if (!buf)
+		return (0);
+	scc.order = buf;
+	scc.low = buf + n;
+	scc.stack = buf + 2 * n;
+	scc.calls = buf + 3 * n;
+	scc.cursors = buf + 4 * n;
+	memset(scc.order, 0xff, n * sizeof(*buf));
+	memset(labels, 0xff, n * sizeof(*labels));
+	for (s = 0; s < n; s++)
+	{
+		if (scc.order[s] != SIZE_MAX)
+			continue;
+		scc_enter(&scc, s);
+		while (scc.nb_calls)
+		{
+			v = scc.calls[scc.nb_calls - 1];
+			cursor = &scc.cursors[scc.nb_calls - 1];
+			if (*cursor == csr->offsets[v + 1])
+			{
+				scc_leave(&scc, v);
+				continue;
+			}
+			w = csr->dests[(*cursor)++];
+			if (scc.order[w] == SIZE_MAX)
+				scc_enter(&scc, w);
+			else if (labels[w] == SIZE_MAX &&
+				 scc.order[w] < scc.low[v])
+				scc.low[v] = scc.order[w];
+		}
+	}
+	/* Tarjan finds sinks first, reverse the numbering */
+	for (v = 0; v < n; v++)
+		labels[v] = scc.count - 1 - labels[v];
+	free(buf);
+	return (scc.count);
+}
+
+/**
+ * graph_strongly_connected_components - Labels the strongly connected
+ * components of a graph, see csr_strongly_connected_components
+ * @graph: Pointer to the graph
+ * @labels: Array of nb_vertices receiving the component of each vertex,
+ * indexed by vertex_t.index
+ *
+ * Return: The number of components, or 0 on failure
+ */
+size_t graph_strongly_connected_components(const graph_t *graph,
+					   size_t *labels)
+{
+	graph_csr_t *csr;
+	size_t count;
+
+	csr = graph_freeze(graph);
+	count = csr_strongly_connected_components(csr, labels);
+	graph_csr_delete(csr);
+	return (count);
+}
@@ -0,0 +1,63 @@
+#include <stdlib.h>
+#include "graphs.h"
+
+/**
+ * csr_topological_sort - Orders the vertices of a CSR snapshot so that
+ * every edge goes from an earlier vertex to a later one
+ * Uses Kahn's algorithm: vertices without incoming edges are taken by
+ * increasing index, then each one is appended as soon as its last
+ * incoming edge is removed. @order doubles as the queue
+ * @csr: Pointer to the snapshot
+ * @order: Array of nb_vertices receiving the vertex indices in topological
+ * order. When the graph has a cycle, it only holds the vertices that
+ * no cycle reaches
+ *
+ * Return: The number of vertices ordered, equal to nb_vertices if and only
+ * if the graph is acyclic, or 0 on failure
+ */
+size_t csr_topological_sort(const graph_csr_t *csr, size_t *order)
+{
+	size_t *indegree, head = 0, tail = 0, v, e;
+
+	if (!csr || !order)
+		return (0);
+	indegree = calloc(csr->nb_vertices ? csr->nb_vertices : 1,
+			  sizeof(*indegree));
+	if (!indegree)
+		return (0);
+	for (e = 0; e < csr->nb_edges; e++)
+		indegree[csr->dests[e]]++;
+	for (v = 0; v < csr->nb_vertices; v++)
+		if (!indegree[v])
+			order[tail++] = v;
+	while (head < tail)
+	{
+		v = order[head++];
+		for (e = csr->offsets[v]; e < csr->offsets[v + 1]; e++)
+			if (!--indegree[csr->dests[e]])
+				order[tail++] = csr->dests[e];
+	}
+	free(indegree);
+	return (tail);
+}
+
+/**
+ * graph_topological_sort - Orders the vertices of a graph topologically,
+ * see csr_topological_sort
+ * A BIDIRECTIONAL edge is a cycle of two vertices
+ * @graph: Pointer to the graph
+ * @order: Array of nb_vertices receiving vertex_t.index values
+ *
+ * Return: The number of vertices ordered, equal to nb_vertices if and only
+ * if the graph is acyclic, or 0 on failure
+ */
+size_t graph_topological_sort(const graph_t *graph, size_t *order)
+{
+	graph_csr_t *csr;
+	size_t count;
+
+	csr = graph_freeze(graph);
+	count = csr_topological_sort(csr, order);
+	graph_csr_delete(csr);
+	return (count);
+}
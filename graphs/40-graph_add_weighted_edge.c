@@ -0,0 +1,105 @@
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <float.h>
+#include "graphs.h"
+
+/**
+ * graph_add_weighted_edge - Adds a weighted edge between two vertices in
+ * the graph, creating them if needed, see graph_add_edge
+ * @graph: A pointer to the graph to add the edge to
+ * @src: The string identifying the source vertex
+ * @dest: The string identifying the destination vertex
+ * @weight: The weight of the edge, in both directions when BIDIRECTIONAL,
+ * finite and not negative
+ * @type: The type of edge (UNIDIRECTIONAL or BIDIRECTIONAL)
+ *
+ * Return: 1 on success, 0 on failure, a rejected weight or duplicate
+ */
+int graph_add_weighted_edge(graph_t *graph, const char *src,
+			    const char *dest, graph_weight_t weight,
+			    edge_type_t type)
+{
+	vertex_t *src_vertex, *dest_vertex;
+
+	if (!graph || !src || !dest)
+		return (0);
+	src_vertex = graph_find_vertex(graph, src);
+	if (!src_vertex)
+		src_vertex = graph_add_vertex(graph, src);
+	dest_vertex = graph_find_vertex(graph, dest);
+	if (!dest_vertex)
+		dest_vertex = graph_add_vertex(graph, dest);
+	if (!src_vertex || !dest_vertex)
+		return (0);
+	return (graph_add_edge_between(graph, src_vertex, dest_vertex, weight,
+				       type));
+}
+
+/**
+ * graph_add_weighted_edge_id - Adds a weighted edge between two vertices
+ * given by their IDs, see graph_add_weighted_edge
+ * @graph: A pointer to the graph to add the edge to
+ * @src: The ID of the source vertex
+ * @dest: The ID of the destination vertex
+ * @weight: The weight of the edge, in both directions when BIDIRECTIONAL,
+ * finite and not negative
+ * @type: The type of edge (UNIDIRECTIONAL or BIDIRECTIONAL)
+ *
+ * Return: 1 on success, 0 on failure, unknown IDs, a rejected weight or
+ * duplicate
+ */
+int graph_add_weighted_edge_id(graph_t *graph, vertex_id_t src,
+			       vertex_id_t dest, graph_weight_t weight,
+			       edge_type_t type)
+{
+	vertex_t *src_vertex, *dest_vertex;
+
+	src_vertex = graph_vertex_by_id(graph, src);
+	dest_vertex = graph_vertex_by_id(graph, dest);
+	if (!src_vertex || !dest_vertex)
+		return (0);
+	return (graph_add_edge_between(graph, src_vertex, dest_vertex, weight,
+				       type));
+}
+
+/**
+ * graph_parse_weight - Parses an edge weight written in decimal
+ * Integer weights must be unsigned and fit in graph_weight_t, float weights
+ * must be finite, not negative and fit in a float, as Dijkstra expects
+ * @str: Start of the weight, not necessarily NUL-terminated
+ * @len: Length of the weight
+ * @weight: Pointer receiving the weight
+ *
+ * Return: 1 on success, 0 if the weight is malformed or out of range
+ */
+int graph_parse_weight(const char *str, size_t len, graph_weight_t *weight)
+{
+	char buf[64], *end;
+#if defined(GRAPH_WEIGHT_FLOAT)
+	double value;
+#else
+	unsigned long long value;
+#endif
+
+	if (!len || len >= sizeof(buf))
+		return (0);
+	memcpy(buf, str, len);
+	buf[len] = '\0';
+#if defined(GRAPH_WEIGHT_FLOAT)
+	value = strtod(buf, &end);
+	if (value < 0 || !isfinite(value) || value > FLT_MAX)
+		return (0);
+#else
+	if (*buf < '0' || *buf > '9')
+		return (0);
+	errno = 0;
+	value = strtoull(buf, &end, 10);
+	if (errno == ERANGE || value > (graph_weight_t)-1)
+		return (0);
+#endif
+	if (*end)
+		return (0);
+	*weight = (graph_weight_t)value;
+	return (1);
+}
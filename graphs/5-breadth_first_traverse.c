@@ -80,6 +80,7 @@ size_t breadth_first_traverse(const graph_t *graph,
 	size_t max_depth = 0;
 	queue_node_t *head = NULL, *tail = NULL, *node;
 	edge_t *edge;
+	const vertex_t *start;
 
 	if (!graph || !graph->vertices || !action)
 		return (0);
@@ -88,7 +89,11 @@ size_t breadth_first_traverse(const graph_t *graph,
 	if (!visited)
 		return (0);
 
-	enqueue(&head, &tail, graph->vertices, 0);
+	for (start = graph->vertices; start; start = start->next)
+		if (!GRAPH_VERTEX_REMOVED(start))
+			break;
+	if (start)
+		enqueue(&head, &tail, start, 0);
 
 	while ((node = dequeue(&head, &tail)))
 	{
@@ -104,7 +109,8 @@ size_t breadth_first_traverse(const graph_t *graph,
 			max_depth = node->depth;
 
 		for (edge = node->vertex->edges; edge; edge = edge->next)
-			if (!visited[edge->dest->index])
+			if (!GRAPH_VERTEX_REMOVED(edge->dest) &&
+			    !visited[edge->dest->index])
 				enqueue(&head, &tail, edge->dest, node->depth + 1);
 
 		free(node);
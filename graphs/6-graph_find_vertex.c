@@ -0,0 +1,65 @@
+#include <string.h>
+#include "graphs.h"
+
+/**
+ * graph_hash_content - Computes the FNV-1a hash of a vertex content
+ * @str: String to hash
+ * @len: Number of bytes of @str to hash
+ *
+ * Return: The hash value
+ */
+size_t graph_hash_content(const char *str, size_t len)
+{
+	size_t hash = (size_t)14695981039346656037ULL;
+
+	while (len--)
+	{
+		hash ^= (unsigned char)*str++;
+		hash *= (size_t)1099511628211ULL;
+	}
+	return (hash);
+}
+
+/**
+ * graph_find_vertex_len - Looks up a vertex by a content that is not
+ * necessarily NUL-terminated
+ * @graph: Pointer to the graph to search
+ * @content: Bytes identifying the vertex
+ * @len: Number of bytes in @content
+ *
+ * Return: Pointer to the vertex, or NULL if it is not in the graph
+ */
+vertex_t *graph_find_vertex_len(const graph_t *graph, const char *content,
+				size_t len)
+{
+	size_t mask, slot;
+	vertex_t *vertex;
+
+	if (!graph || !content || !graph->nb_buckets)
+		return (NULL);
+
+	mask = graph->nb_buckets - 1;
+	slot = graph_hash_content(content, len) & mask;
+	while ((vertex = graph->buckets[slot]))
+	{
+		if (strncmp(vertex->content, content, len) == 0 &&
+		    vertex->content[len] == '\0')
+			return (vertex);
+		slot = (slot + 1) & mask;
+	}
+	return (NULL);
+}
+
+/**
+ * graph_find_vertex - Looks up a vertex by its content
+ * @graph: Pointer to the graph to search
+ * @content: String identifying the vertex
+ *
+ * Return: Pointer to the vertex, or NULL if it is not in the graph
+ */
+vertex_t *graph_find_vertex(const graph_t *graph, const char *content)
+{
+	if (!content)
+		return (NULL);
+	return (graph_find_vertex_len(graph, content, strlen(content)));
+}
@@ -0,0 +1,161 @@
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include "graphs.h"
+
+/**
+ * graph_csr_delete - Frees a CSR snapshot, or unmaps it if it was opened
+ * with graph_open_mapped
+ * The vertices it refers to belong to the graph and are left untouched
+ * @csr: Pointer to the snapshot to free
+ */
+void graph_csr_delete(graph_csr_t *csr)
+{
+	if (!csr)
+		return;
+
+	if (csr->mapping)
+	{
+		munmap(csr->mapping, csr->mapping_size);
+	}
+	else
+	{
+		free(csr->offsets);
+		free(csr->dests);
+		free(csr->weights);
+	}
+	free(csr->pool);
+	free(csr->vertices);
+	free(csr);
+}
+
+/**
+ * csr_alloc - Allocates an empty CSR snapshot with room for a graph
+ * @nb_vertices: Number of vertices to make room for
+ * @nb_edges: Number of edges to make room for
+ *
+ * Return: Pointer to the snapshot, or NULL on failure
+ */
+static graph_csr_t *csr_alloc(size_t nb_vertices, size_t nb_edges)
+{
+	graph_csr_t *csr;
+
+	csr = calloc(1, sizeof(*csr));
+	if (!csr)
+		return (NULL);
+
+	csr->nb_vertices = nb_vertices;
+	csr->nb_edges = nb_edges;
+	csr->offsets = calloc(nb_vertices + 1, sizeof(*csr->offsets));
+	csr->dests = malloc((nb_edges ? nb_edges : 1) * sizeof(*csr->dests));
+	csr->weights = malloc((nb_edges ? nb_edges : 1) *
+			      sizeof(*csr->weights));
+	csr->vertices = malloc((nb_vertices ? nb_vertices : 1) *
+			       sizeof(*csr->vertices));
+	if (!csr->offsets || !csr->dests || !csr->weights || !csr->vertices)
+	{
+		graph_csr_delete(csr);
+		return (NULL);
+	}
+	return (csr);
+}
+
+/**
+ * graph_freeze - Builds a compressed-sparse-row snapshot of a graph
+ * The snapshot is independent from the adjacency lists, but keeps pointers
+ * to the vertices of @graph, so it must not outlive it. Removed vertices
+ * keep their index, without any edge. Edge weights are copied to the
+ * weights array, parallel to dests
+ * @graph: Pointer to the graph to freeze
+ *
+ * Return: Pointer to the snapshot, or NULL on failure
+ */
+graph_csr_t *graph_freeze(const graph_t *graph)
+{
+	graph_csr_t *csr;
+	vertex_t *vertex;
+	edge_t *edge;
+	size_t nb_edges = 0, pos = 0;
+
+	if (!graph)
+		return (NULL);
+
+	for (vertex = graph->vertices; vertex; vertex = vertex->next)
+		for (edge = vertex->edges; edge; edge = edge->next)
+			nb_edges += !GRAPH_VERTEX_REMOVED(edge->dest);
+
+	csr = csr_alloc(graph->nb_vertices, nb_edges);
+	if (!csr)
+		return (NULL);
+
+	for (vertex = graph->vertices; vertex; vertex = vertex->next)
+	{
+		csr->vertices[vertex->index] = vertex;
+		csr->offsets[vertex->index] = pos;
+		for (edge = vertex->edges; edge; edge = edge->next)
+			if (!GRAPH_VERTEX_REMOVED(edge->dest))
+			{
+				csr->weights[pos] = edge->weight;
+				csr->dests[pos++] = edge->dest->index;
+			}
+	}
+	csr->offsets[csr->nb_vertices] = pos;
+
+	return (csr);
+}
+
+/**
+ * graph_csr_transpose - Builds the snapshot of the reversed graph
+ * The neighbours of a vertex in the result are the sources of its incoming
+ * edges, by increasing index, with the weights of those edges. The result
+ * shares the vertices, or the names, of @csr, so it must not outlive it
+ * @csr: Pointer to the snapshot to reverse
+ *
+ * Return: Pointer to the reversed snapshot, or NULL on failure
+ */
+graph_csr_t *graph_csr_transpose(const graph_csr_t *csr)
+{
+	graph_csr_t *rev;
+	size_t v, e, at;
+
+	if (!csr)
+		return (NULL);
+
+	rev = csr_alloc(csr->nb_vertices, csr->nb_edges);
+	if (!rev)
+		return (NULL);
+
+	for (e = 0; e < csr->nb_edges; e++)
+		rev->offsets[csr->dests[e] + 1]++;
+	for (v = 0; v < csr->nb_vertices; v++)
+		rev->offsets[v + 1] += rev->offsets[v];
+	if (csr->vertices)
+		memcpy(rev->vertices, csr->vertices,
+		       csr->nb_vertices * sizeof(*rev->vertices));
+	else
+	{
+		free(rev->vertices);
+		rev->vertices = NULL;
+		rev->names = csr->names;
+		rev->strings = csr->strings;
+	}
+	if (!csr->weights)
+	{
+		free(rev->weights);
+		rev->weights = NULL;
+	}
+	for (v = 0; v < csr->nb_vertices; v++)
+		for (e = csr->offsets[v]; e < csr->offsets[v + 1]; e++)
+		{
+			at = rev->offsets[csr->dests[e]]++;
+			rev->dests[at] = v;
+			if (rev->weights)
+				rev->weights[at] = csr->weights[e];
+		}
+	/* Each offset now holds the end of its list, shift them back */
+	for (v = csr->nb_vertices; v > 0; v--)
+		rev->offsets[v] = rev->offsets[v - 1];
+	rev->offsets[0] = 0;
+
+	return (rev);
+}
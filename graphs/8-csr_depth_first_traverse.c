@@ -0,0 +1,65 @@
+#include <stdlib.h>
+#include "graphs.h"
+
+/**
+ * csr_depth_first_traverse - Traverses a CSR snapshot using depth-first search
+ * The traversal starts from the first vertex that is not removed and visits
+ * vertices in the same order, and at the same depths, as depth_first_traverse.
+ * It uses an explicit stack of edge cursors instead of recursion
+ * @csr: Pointer to the snapshot to traverse
+ * @action: Function to be called for each visited vertex
+ *
+ * Return: The maximum depth reached, or 0 on failure
+ */
+size_t csr_depth_first_traverse(const graph_csr_t *csr,
+	void (*action)(const vertex_t *v, size_t depth))
+{
+	unsigned char *visited;
+	size_t *stack, *cursor, top = 0, max_depth = 0, dest, start;
+	vertex_t stub;
+
+	if (!csr || !action)
+		return (0);
+	start = graph_csr_first(csr);
+	if (start == csr->nb_vertices)
+		return (0);
+
+	visited = calloc(csr->nb_vertices, sizeof(*visited));
+	stack = malloc(csr->nb_vertices * sizeof(*stack));
+	cursor = malloc(csr->nb_vertices * sizeof(*cursor));
+	if (!visited || !stack || !cursor)
+	{
+		free(visited);
+		free(stack);
+		free(cursor);
+		return (0);
+	}
+
+	visited[start] = 1;
+	action(graph_csr_vertex(csr, start, &stub), 0);
+	stack[0] = start;
+	cursor[0] = csr->offsets[start];
+	while (1)
+	{
+		if (cursor[top] == csr->offsets[stack[top] + 1])
+		{
+			if (!top--)
+				break;
+			continue;
+		}
+		dest = csr->dests[cursor[top]++];
+		if (visited[dest])
+			continue;
+		visited[dest] = 1;
+		action(graph_csr_vertex(csr, dest, &stub), ++top);
+		if (top > max_depth)
+			max_depth = top;
+		stack[top] = dest;
+		cursor[top] = csr->offsets[dest];
+	}
+
+	free(visited);
+	free(stack);
+	free(cursor);
+	return (max_depth);
+}
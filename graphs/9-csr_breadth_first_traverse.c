@@ -0,0 +1,62 @@
+#include <stdlib.h>
+#include "graphs.h"
+
+/**
+ * csr_breadth_first_traverse - Traverses a CSR snapshot using BFS
+ * The traversal starts from the first vertex that is not removed and visits
+ * vertices in the same order, and at the same depths, as
+ * breadth_first_traverse.
+ * Vertices are marked when enqueued, so the queue is a single array of
+ * nb_vertices indices and no vertex is ever enqueued twice
+ * @csr: Pointer to the snapshot to traverse
+ * @action: Function to be called for each visited vertex
+ *
+ * Return: The maximum depth reached, or 0 on failure
+ */
+size_t csr_breadth_first_traverse(const graph_csr_t *csr,
+	void (*action)(const vertex_t *v, size_t depth))
+{
+	unsigned char *visited;
+	size_t *queue, *depth, head = 0, tail = 0, max_depth = 0, v, e;
+	vertex_t stub;
+
+	if (!csr || !action)
+		return (0);
+	v = graph_csr_first(csr);
+	if (v == csr->nb_vertices)
+		return (0);
+
+	visited = calloc(csr->nb_vertices, sizeof(*visited));
+	queue = malloc(csr->nb_vertices * sizeof(*queue));
+	depth = malloc(csr->nb_vertices * sizeof(*depth));
+	if (!visited || !queue || !depth)
+	{
+		free(visited);
+		free(queue);
+		free(depth);
+		return (0);
+	}
+
+	visited[v] = 1;
+	depth[v] = 0;
+	queue[tail++] = v;
+	while (head < tail)
+	{
+		v = queue[head++];
+		action(graph_csr_vertex(csr, v, &stub), depth[v]);
+		max_depth = depth[v];
+		for (e = csr->offsets[v]; e < csr->offsets[v + 1]; e++)
+		{
+			if (visited[csr->dests[e]])
+				continue;
+			visited[csr->dests[e]] = 1;
+			depth[csr->dests[e]] = depth[v] + 1;
+			queue[tail++] = csr->dests[e];
+		}
+	}
+
+	free(visited);
+	free(queue);
+	free(depth);
+	return (max_depth);
+}
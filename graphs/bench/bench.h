@@ -0,0 +1,58 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+/*
+ * Benchmark of the graphs module, built from the graphs/ directory with:
+ * gcc -O2 -pthread -I. *.c bench/graph_bench.c bench/bench_*.c -o graph_bench
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include "../graphs.h"
+
+/**
+ * struct bench_edges_s - Edge list produced by a synthetic generator
+ *
+ * @nb_vertices: Number of vertices, numbered from 0
+ * @nb_edges: Number of edges
+ * @pairs: Array of 2 * nb_edges (source, destination) vertex numbers
+ */
+typedef struct bench_edges_s
+{
+	size_t nb_vertices;
+	size_t nb_edges;
+	uint32_t *pairs;
+} bench_edges_t;
+
+/**
+ * struct bench_config_s - Parameters of a benchmark session
+ *
+ * @generator: Name of the generator the edges come from
+ * @scale: Base 2 logarithm of the number of vertices
+ * @edge_factor: Number of edges per vertex, for the random generators
+ * @runs: Number of times each measure is repeated
+ * @seed: Seed of the random generators
+ */
+typedef struct bench_config_s
+{
+	const char *generator;
+	unsigned int scale;
+	size_t edge_factor;
+	size_t runs;
+	uint64_t seed;
+} bench_config_t;
+
+/* Generators, all returning 1 on success and 0 on failure */
+int bench_rmat(bench_edges_t *edges, const bench_config_t *config);
+int bench_erdos_renyi(bench_edges_t *edges, const bench_config_t *config);
+int bench_grid(bench_edges_t *edges, const bench_config_t *config);
+int bench_chain(bench_edges_t *edges, const bench_config_t *config);
+
+/* Measures */
+uint64_t bench_random(uint64_t *state);
+double bench_now(void);
+size_t bench_peak_rss(void);
+void bench_report(const bench_config_t *config, const bench_edges_t *edges,
+		  const char *bench, const char *unit, double *samples);
+
+#endif /* BENCH_H */
@@ -0,0 +1,138 @@
+#include <stdlib.h>
+#include "bench.h"
+
+/* Quadrant probabilities of the Graph500 R-MAT generator, in 1/100 */
+#define RMAT_A 57
+#define RMAT_B 19
+#define RMAT_C 19
+
+/**
+ * edges_alloc - Allocates the pairs of an edge list
+ * @edges: Edge list to fill in
+ * @nb_vertices: Number of vertices
+ * @nb_edges: Number of edges
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int edges_alloc(bench_edges_t *edges, size_t nb_vertices,
+		       size_t nb_edges)
+{
+	edges->nb_vertices = nb_vertices;
+	edges->nb_edges = nb_edges;
+	edges->pairs = malloc((nb_edges ? nb_edges : 1) * 2 *
+			      sizeof(*edges->pairs));
+	return (edges->pairs != NULL);
+}
+
+/**
+ * bench_rmat - Generates a recursive-matrix (R-MAT) graph, whose skewed
+ * degrees look like those of social and web graphs
+ * Each edge picks one quadrant of the adjacency matrix per bit of scale
+ * @edges: Edge list to fill in
+ * @config: Benchmark parameters
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int bench_rmat(bench_edges_t *edges, const bench_config_t *config)
+{
+	uint64_t state = config->seed, r;
+	size_t e;
+	uint32_t src, dest, bit;
+
+	if (!edges_alloc(edges, (size_t)1 << config->scale,
+			 ((size_t)1 << config->scale) * config->edge_factor))
+		return (0);
+	for (e = 0; e < edges->nb_edges; e++)
+	{
+		src = 0;
+		dest = 0;
+		for (bit = 1; bit < edges->nb_vertices; bit <<= 1)
+		{
+			r = bench_random(&state) % 100;
+			if (r >= RMAT_A + RMAT_B)
+				src |= bit;
+			if (r >= RMAT_A + RMAT_B + RMAT_C ||
+			    (r >= RMAT_A && r < RMAT_A + RMAT_B))
+				dest |= bit;
+		}
+		edges->pairs[e * 2] = src;
+		edges->pairs[e * 2 + 1] = dest;
+	}
+	return (1);
+}
+
+/**
+ * bench_erdos_renyi - Generates a uniform random graph G(n, m)
+ * @edges: Edge list to fill in
+ * @config: Benchmark parameters
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int bench_erdos_renyi(bench_edges_t *edges, const bench_config_t *config)
+{
+	uint64_t state = config->seed;
+	size_t e;
+
+	if (!edges_alloc(edges, (size_t)1 << config->scale,
+			 ((size_t)1 << config->scale) * config->edge_factor))
+		return (0);
+	for (e = 0; e < edges->nb_edges * 2; e++)
+		edges->pairs[e] = bench_random(&state) % edges->nb_vertices;
+	return (1);
+}
+
+/**
+ * bench_grid - Generates a 2-D grid, each vertex linked to its right and
+ * lower neighbours
+ * @edges: Edge list to fill in
+ * @config: Benchmark parameters
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int bench_grid(bench_edges_t *edges, const bench_config_t *config)
+{
+	size_t width = (size_t)1 << (config->scale / 2);
+	size_t height = (size_t)1 << (config->scale - config->scale / 2);
+	size_t x, y, e = 0;
+
+	if (!edges_alloc(edges, width * height,
+			 (width - 1) * height + width * (height - 1)))
+		return (0);
+	for (y = 0; y < height; y++)
+		for (x = 0; x < width; x++)
+		{
+			if (x + 1 < width)
+			{
+				edges->pairs[e++] = y * width + x;
+				edges->pairs[e++] = y * width + x + 1;
+			}
+			if (y + 1 < height)
+			{
+				edges->pairs[e++] = y * width + x;
+				edges->pairs[e++] = (y + 1) * width + x;
+			}
+		}
+	return (1);
+}
+
+/**
+ * bench_chain - Generates a single path through every vertex, the worst
+ * case for traversal depth
+ * @edges: Edge list to fill in
+ * @config: Benchmark parameters
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int bench_chain(bench_edges_t *edges, const bench_config_t *config)
+{
+	size_t n = (size_t)1 << config->scale, v;
+
+	if (!edges_alloc(edges, n, n - 1))
+		return (0);
+	for (v = 0; v + 1 < n; v++)
+	{
+		edges->pairs[v * 2] = v;
+		edges->pairs[v * 2 + 1] = v + 1;
+	}
+	return (1);
+}
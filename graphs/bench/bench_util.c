@@ -0,0 +1,96 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <sys/resource.h>
+#include "bench.h"
+
+/**
+ * bench_random - Draws the next number of a splitmix64 sequence
+ * @state: Pointer to the state of the sequence
+ *
+ * Return: A uniformly distributed 64-bit number
+ */
+uint64_t bench_random(uint64_t *state)
+{
+	uint64_t z;
+
+	z = (*state += 0x9e3779b97f4a7c15ULL);
+	z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+	return (z ^ (z >> 31));
+}
+
+/**
+ * bench_now - Reads a monotonic clock
+ *
+ * Return: The time in seconds
+ */
+double bench_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec / 1e9);
+}
+
+/**
+ * bench_peak_rss - Gets the peak resident set size of the process
+ * graph_bench runs each generator in a process of its own, so this is the
+ * peak of that generator alone
+ *
+ * Return: The peak RSS in kilobytes, or 0 if it is unknown
+ */
+size_t bench_peak_rss(void)
+{
+	struct rusage usage;
+
+	if (getrusage(RUSAGE_SELF, &usage))
+		return (0);
+	return ((size_t)usage.ru_maxrss);
+}
+
+/**
+ * cmp_double - Orders doubles increasingly
+ * @a: Pointer to the first double
+ * @b: Pointer to the second double
+ *
+ * Return: A negative, zero or positive value, as qsort expects
+ */
+static int cmp_double(const void *a, const void *b)
+{
+	double x = *(const double *)a, y = *(const double *)b;
+
+	return ((x > y) - (x < y));
+}
+
+/**
+ * bench_report - Prints the distribution of a measure as one JSON object
+ * per line, so results can be tracked over time
+ * Percentiles use the nearest rank over the sorted samples
+ * @config: Benchmark parameters
+ * @edges: Edge list the graph was built from
+ * @bench: Name of the measure
+ * @unit: Unit of the samples
+ * @samples: Array of config->runs samples, sorted in place
+ */
+void bench_report(const bench_config_t *config, const bench_edges_t *edges,
+		  const char *bench, const char *unit, double *samples)
+{
+	size_t n = config->runs;
+
+	qsort(samples, n, sizeof(*samples), cmp_double);
+	printf("{\"bench\":\"%s\",\"generator\":\"%s\",\"scale\":%u,"
+	       "\"edge_factor\":%lu,\"vertices\":%lu,\"edges\":%lu,"
+	       "\"runs\":%lu,\"unit\":\"%s\",\"min\":%.6g,\"p50\":%.6g,"
+	       "\"p90\":%.6g,\"p99\":%.6g,\"max\":%.6g,"
+	       "\"peak_rss_kb\":%lu}\n",
+	       bench, config->generator, config->scale,
+	       (unsigned long)config->edge_factor,
+	       (unsigned long)edges->nb_vertices,
+	       (unsigned long)edges->nb_edges, (unsigned long)n, unit,
+	       samples[0], samples[(n - 1) / 2],
+	       samples[(n * 90 + 99) / 100 - 1],
+	       samples[(n * 99 + 99) / 100 - 1], samples[n - 1],
+	       (unsigned long)bench_peak_rss());
+	fflush(stdout);
+}
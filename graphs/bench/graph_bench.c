@@ -0,0 +1,220 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "bench.h"
+
+/**
+ * struct bench_generator_s - Generator selectable on the command line
+ *
+ * @name: Name given to -g
+ * @generate: Function building the edge list
+ */
+typedef struct bench_generator_s
+{
+	const char *name;
+	int (*generate)(bench_edges_t *edges, const bench_config_t *config);
+} bench_generator_t;
+
+static size_t traversed;
+
+/**
+ * count_edges - Traversal action summing the edges leaving visited vertices
+ * @v: Visited vertex
+ * @depth: Depth of @v, unused
+ */
+static void count_edges(const vertex_t *v, size_t depth)
+{
+	(void)depth;
+	traversed += v->nb_edges;
+}
+
+/**
+ * bench_load - Measures graph_add_edge, building the graph once per run
+ * Edges are added in both directions, names are formatted beforehand
+ * @config: Benchmark parameters
+ * @edges: Edge list to load
+ * @names: Array of the names of the vertices
+ *
+ * Return: The graph built by the last run, or NULL on failure
+ */
+static graph_t *bench_load(const bench_config_t *config,
+			   const bench_edges_t *edges, char **names)
+{
+	double *samples, start;
+	graph_t *graph = NULL;
+	size_t run, e;
+
+	samples = malloc(config->runs * sizeof(*samples));
+	for (run = 0; samples && run < config->runs; run++)
+	{
+		graph_delete(graph);
+		graph = graph_create();
+		if (!graph)
+			break;
+		start = bench_now();
+		for (e = 0; e < edges->nb_edges; e++)
+			graph_add_edge(graph, names[edges->pairs[e * 2]],
+				       names[edges->pairs[e * 2 + 1]],
+				       BIDIRECTIONAL);
+		samples[run] = edges->nb_edges / (bench_now() - start);
+	}
+	if (samples && graph)
+		bench_report(config, edges, "load", "edges_per_sec", samples);
+	else
+	{
+		graph_delete(graph);
+		graph = NULL;
+	}
+	free(samples);
+	return (graph);
+}
+
+/**
+ * bench_traverse - Measures a traversal in traversed edges per second
+ * (TEPS), counting the edges leaving every visited vertex
+ * @config: Benchmark parameters
+ * @edges: Edge list the graph was built from
+ * @name: Name of the measure
+ * @traverse: Traversal of @graph to measure, or NULL
+ * @graph: Graph to traverse
+ * @csr_traverse: Traversal of @csr to measure, when @traverse is NULL
+ * @csr: Snapshot of @graph
+ */
+static void bench_traverse(const bench_config_t *config,
+	const bench_edges_t *edges, const char *name,
+	size_t (*traverse)(const graph_t *, void (*)(const vertex_t *, size_t)),
+	const graph_t *graph,
+	size_t (*csr_traverse)(const graph_csr_t *,
+			       void (*)(const vertex_t *, size_t)),
+	const graph_csr_t *csr)
+{
+	double *samples, start;
+	size_t run;
+
+	samples = malloc(config->runs * sizeof(*samples));
+	for (run = 0; samples && run < config->runs; run++)
+	{
+		traversed = 0;
+		start = bench_now();
+		if (traverse)
+			traverse(graph, count_edges);
+		else
+			csr_traverse(csr, count_edges);
+		samples[run] = traversed / (bench_now() - start);
+	}
+	if (samples)
+		bench_report(config, edges, name, "teps", samples);
+	free(samples);
+}
+
+/**
+ * bench_generator - Runs every measure on the graph of one generator
+ * @config: Benchmark parameters
+ * @generate: Function building the edge list
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int bench_generator(const bench_config_t *config,
+	int (*generate)(bench_edges_t *edges, const bench_config_t *config))
+{
+	bench_edges_t edges = {0, 0, NULL};
+	char **names = NULL, *pool = NULL;
+	graph_t *graph = NULL;
+	graph_csr_t *csr = NULL;
+	size_t v;
+	int ok;
+
+	if (generate(&edges, config))
+	{
+		names = malloc(edges.nb_vertices * sizeof(*names));
+		pool = malloc(edges.nb_vertices * 12);
+	}
+	for (v = 0; names && pool && v < edges.nb_vertices; v++)
+	{
+		names[v] = pool + v * 12;
+		sprintf(names[v], "%lu", (unsigned long)v);
+	}
+	graph = names && pool ? bench_load(config, &edges, names) : NULL;
+	csr = graph_freeze(graph);
+	if (csr)
+	{
+		bench_traverse(config, &edges, "bfs", breadth_first_traverse,
+			       graph, NULL, csr);
+		bench_traverse(config, &edges, "dfs", depth_first_traverse,
+			       graph, NULL, csr);
+		bench_traverse(config, &edges, "csr_bfs", NULL, graph,
+			       csr_breadth_first_traverse, csr);
+		bench_traverse(config, &edges, "csr_dfs", NULL, graph,
+			       csr_depth_first_traverse, csr);
+	}
+	ok = csr != NULL;
+	graph_csr_delete(csr);
+	graph_delete(graph);
+	free(names);
+	free(pool);
+	free(edges.pairs);
+	return (ok);
+}
+
+/**
+ * main - Benchmarks loading and traversing synthetic graphs
+ * Usage: graph_bench [-g rmat|er|grid|chain] [-s scale] [-e edge_factor]
+ * [-r runs] [-S seed]. Without -g, every generator is measured in turn
+ * Each generator runs in a child process of its own, so the peak RSS it
+ * reports only accounts for its own graph
+ * @argc: Number of arguments
+ * @argv: Array of arguments
+ *
+ * Return: EXIT_SUCCESS, or EXIT_FAILURE on bad usage or failure
+ */
+int main(int argc, char **argv)
+{
+	static const bench_generator_t generators[] = {
+		{"rmat", bench_rmat}, {"er", bench_erdos_renyi},
+		{"grid", bench_grid}, {"chain", bench_chain}, {NULL, NULL}
+	};
+	bench_config_t config = {NULL, 14, 16, 5, 42};
+	const char *only = NULL;
+	int opt, i, ok = 1, found = 0, status;
+	pid_t pid;
+
+	while ((opt = getopt(argc, argv, "g:s:e:r:S:")) != -1)
+	{
+		if (opt == 'g')
+			only = optarg;
+		else if (opt == 's')
+			config.scale = atoi(optarg);
+		else if (opt == 'e')
+			config.edge_factor = strtoul(optarg, NULL, 10);
+		else if (opt == 'r')
+			config.runs = strtoul(optarg, NULL, 10);
+		else if (opt == 'S')
+			config.seed = strtoull(optarg, NULL, 10);
+		else
+			return (EXIT_FAILURE);
+	}
+	if (config.scale < 1 || config.scale > 31 || !config.runs)
+	{
+		fprintf(stderr, "graph_bench: scale must be 1..31, runs > 0\n");
+		return (EXIT_FAILURE);
+	}
+	for (i = 0; generators[i].name && ok; i++)
+		if (!only || !strcmp(only, generators[i].name))
+		{
+			found = 1;
+			config.generator = generators[i].name;
+			pid = fork();
+			if (!pid)
+				_exit(bench_generator(&config,
+						      generators[i].generate) ?
+				      EXIT_SUCCESS : EXIT_FAILURE);
+			ok = pid > 0 && waitpid(pid, &status, 0) == pid &&
+				WIFEXITED(status) &&
+				WEXITSTATUS(status) == EXIT_SUCCESS;
+		}
+	if (!found)
+		fprintf(stderr, "graph_bench: unknown generator %s\n", only);
+	return (ok && found ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -2,6 +2,10 @@
 #define GRAPHS_H
 
 #include <stddef.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <math.h>
+#include <pthread.h>
 
 /**
  * enum edge_type_e - Enumerates the different types of
@@ -16,6 +20,35 @@ typedef enum edge_type_e
 	BIDIRECTIONAL
 } edge_type_t;
 
+/*
+ * Weight of an edge, 32-bit unsigned by default. Build everything with
+ * GRAPH_WEIGHT_UINT64 or GRAPH_WEIGHT_FLOAT defined to change it. Path
+ * lengths add up in the wider graph_dist_t, printed with GRAPH_DIST_FMT
+ * and GRAPH_DIST_ARG, and GRAPH_WEIGHT_KIND tags binary snapshot files
+ */
+#if defined(GRAPH_WEIGHT_FLOAT)
+typedef float graph_weight_t;
+typedef double graph_dist_t;
+#define GRAPH_DIST_MAX HUGE_VAL
+#define GRAPH_WEIGHT_KIND 3
+#define GRAPH_DIST_FMT "%g"
+#define GRAPH_DIST_ARG(d) ((double)(d))
+#elif defined(GRAPH_WEIGHT_UINT64)
+typedef uint64_t graph_weight_t;
+typedef uint64_t graph_dist_t;
+#define GRAPH_DIST_MAX UINT64_MAX
+#define GRAPH_WEIGHT_KIND 2
+#define GRAPH_DIST_FMT "%" PRIu64
+#define GRAPH_DIST_ARG(d) ((uint64_t)(d))
+#else
+typedef uint32_t graph_weight_t;
+typedef uint64_t graph_dist_t;
+#define GRAPH_DIST_MAX UINT64_MAX
+#define GRAPH_WEIGHT_KIND 1
+#define GRAPH_DIST_FMT "%" PRIu64
+#define GRAPH_DIST_ARG(d) ((uint64_t)(d))
+#endif
+
 /* Define the structure temporarily for usage in the edge_t */
 typedef struct vertex_s vertex_t;
 
@@ -23,20 +56,26 @@ typedef struct vertex_s vertex_t;
  * struct edge_s - Node in the linked list of edges for a given vertex
  * A single vertex can have many edges
  *
+ * The weight comes last: the pointers stay packed, and a 32-bit weight
+ * only leaves tail padding. Edges still take 24 bytes on 64-bit targets
+ *
  * @dest: Pointer to the connected vertex
  * @next: Pointer to the next edge
+ * @weight: Weight of the edge, 1 unless added with graph_add_weighted_edge
  */
 typedef struct edge_s
 {
 	vertex_t *dest;
 	struct edge_s *next;
+	graph_weight_t weight;
 } edge_t;
 
 /**
  * struct vertex_s - Node in the linked list of vertices in the adjacency list
  *
  * @index: Index of the vertex in the adjacency list.
- * @content: Custom data stored in the vertex (here, a string)
+ * @content: Custom data stored in the vertex (here, a string), NULL once
+ *   the vertex is removed, until graph_compact unlinks it
  * @nb_edges: Number of conenctions with other vertices in the graph
  * @edges: Pointer to the head node of the linked list of edges
  * @next: Pointer to the next vertex in the adjacency linked list
@@ -52,19 +91,280 @@ struct vertex_s
 	struct vertex_s *next;
 };
 
+/*
+ * Dense integer identifier of a vertex, equal to its index: interning a
+ * name once lets edges, traversals and searches skip strings entirely
+ */
+typedef uint32_t vertex_id_t;
+#define GRAPH_NO_ID UINT32_MAX
+
+/* Whether a vertex was removed with graph_remove_vertex */
+#define GRAPH_VERTEX_REMOVED(v) (!(v)->content)
+
+/**
+ * struct graph_slab_s - Slab of memory in the arena of a graph
+ * Items are bump-allocated from @data and never freed individually
+ *
+ * @next: Pointer to the previously allocated slab
+ * @size: Number of bytes available in @data
+ * @used: Number of bytes already handed out from @data
+ * @data: Storage of the slab
+ */
+typedef struct graph_slab_s
+{
+	struct graph_slab_s *next;
+	size_t size;
+	size_t used;
+	unsigned char data[];
+} graph_slab_t;
+
+/**
+ * enum graph_order_e - Vertex orderings supported by graph_reorder
+ *
+ * @GRAPH_ORDER_RCM: Reverse Cuthill-McKee, BFS from low-degree vertices
+ *   visiting neighbours by increasing degree, reversed
+ * @GRAPH_ORDER_BFS: Breadth-first order from the first vertex, then from
+ *   every vertex not reached yet
+ * @GRAPH_ORDER_DEGREE: Decreasing number of edges
+ */
+typedef enum graph_order_e
+{
+	GRAPH_ORDER_RCM = 0,
+	GRAPH_ORDER_BFS,
+	GRAPH_ORDER_DEGREE
+} graph_order_t;
+
+/**
+ * struct graph_edge_slot_s - Slot of the hash index of the edges of a graph
+ *
+ * @src: Source vertex of the edge, NULL for an empty slot
+ * @dest: Destination vertex of the edge
+ */
+typedef struct graph_edge_slot_s
+{
+	const vertex_t *src;
+	const vertex_t *dest;
+} graph_edge_slot_t;
+
+/* Flags given to graph_create_flags() */
+#define GRAPH_ARENA 0x1
+#define GRAPH_UNIQUE_EDGES 0x2
+
+/* Vertices with at least that many edges have them in the edge index */
+#define GRAPH_EDGE_INDEX_MIN 8
+
+/* Flags only understood by graph_load_edgelist() */
+#define GRAPH_LOAD_BIDIRECTIONAL 0x100
+
 /**
  * struct graph_s - Representation of a graph
  * We use an adjacency linked list to represent our graph
  *
- * @nb_vertices: Number of vertices in our graph
+ * @nb_vertices: Number of vertices in our graph, counting removed ones
+ *   until graph_compact renumbers the others
  * @vertices: Pointer to the head node of our adjacency linked list
+ * @tail: Pointer to the last node of our adjacency linked list
+ * @buckets: Open-addressing hash index mapping content to vertex
+ * @nb_buckets: Size of @buckets (always a power of two, or 0)
+ * @flags: Flags the graph was created with (GRAPH_ARENA, ...)
+ * @slabs: Pointer to the most recent arena slab, when GRAPH_ARENA is set
+ * @edge_buckets: Open-addressing hash index of the edges leaving vertices
+ *   with at least GRAPH_EDGE_INDEX_MIN edges
+ * @nb_edge_buckets: Size of @edge_buckets (always a power of two, or 0)
+ * @nb_indexed_edges: Number of edges in @edge_buckets
+ * @nb_removed: Number of removed vertices still taking up an index
+ * @by_id: Array mapping a vertex index (or ID) to its vertex
+ * @by_id_size: Number of vertices @by_id has room for
  */
 typedef struct graph_s
 {
 	size_t nb_vertices;
 	vertex_t *vertices;
+	vertex_t *tail;
+	vertex_t **buckets;
+	size_t nb_buckets;
+	unsigned int flags;
+	graph_slab_t *slabs;
+	graph_edge_slot_t *edge_buckets;
+	size_t nb_edge_buckets;
+	size_t nb_indexed_edges;
+	size_t nb_removed;
+	vertex_t **by_id;
+	size_t by_id_size;
 } graph_t;
 
+/**
+ * struct graph_csr_s - Frozen compressed-sparse-row snapshot of a graph
+ * The neighbours of the vertex of index i are stored contiguously in
+ * dests[offsets[i]] .. dests[offsets[i + 1] - 1], in the same order as
+ * its edges list
+ *
+ * @nb_vertices: Number of vertices in the snapshot
+ * @nb_edges: Number of directed edges in the snapshot
+ * @offsets: Array of nb_vertices + 1 offsets into @dests
+ * @dests: Array of nb_edges destination vertex indices
+ * @weights: Array of nb_edges edge weights, parallel to @dests, or NULL
+ *   when every edge weighs 1
+ * @vertices: Array mapping a vertex index to its vertex in the graph,
+ *   NULL for a snapshot opened with graph_open_mapped
+ * @names: Array mapping a vertex index to the offset of its name in
+ *   @strings, when @vertices is NULL
+ * @strings: Pool of NUL-terminated vertex names, when @vertices is NULL
+ * @mapping: Start of the file mapping the arrays live in, or NULL when
+ *   the snapshot owns them
+ * @mapping_size: Size of @mapping in bytes
+ * @pool: Block holding @names and @strings when the snapshot owns them,
+ *   see graph_snapshot
+ */
+typedef struct graph_csr_s
+{
+	size_t nb_vertices;
+	size_t nb_edges;
+	size_t *offsets;
+	size_t *dests;
+	graph_weight_t *weights;
+	vertex_t **vertices;
+	const size_t *names;
+	const char *strings;
+	void *mapping;
+	size_t mapping_size;
+	void *pool;
+} graph_csr_t;
+
+/**
+ * struct graph_packed_s - Read-only snapshot of a graph whose adjacency is
+ * compressed, see graph_pack
+ * The list of the vertex of index i starts at bytes[offsets[i]] with its
+ * degree, then its first neighbour relative to i, zigzag-encoded, then the
+ * gaps between its neighbours sorted by increasing index, each of them as
+ * a LEB128 variable-length integer
+ *
+ * @nb_vertices: Number of vertices in the snapshot
+ * @nb_edges: Number of directed edges in the snapshot
+ * @offsets: Array of nb_vertices + 1 offsets into @bytes
+ * @bytes: Encoded adjacency lists
+ * @vertices: Array mapping a vertex index to its vertex in the graph, or
+ *   NULL when the snapshot it was packed from had none
+ * @names: Array mapping a vertex index to the offset of its name in
+ *   @strings, when @vertices is NULL
+ * @strings: Pool of NUL-terminated vertex names, when @vertices is NULL
+ */
+typedef struct graph_packed_s
+{
+	size_t nb_vertices;
+	size_t nb_edges;
+	size_t *offsets;
+	unsigned char *bytes;
+	vertex_t **vertices;
+	size_t *names;
+	char *strings;
+} graph_packed_t;
+
+/**
+ * struct graph_reader_slot_s - Epoch announced by a reader thread of a
+ * publisher, alone on its cache line
+ *
+ * @epoch: Epoch of the publisher when the reader pinned a snapshot, 0 while
+ *   it holds none
+ * @pad: Padding up to 64 bytes
+ */
+typedef struct graph_reader_slot_s
+{
+	uint64_t epoch;
+	unsigned char pad[64 - sizeof(uint64_t)];
+} graph_reader_slot_t;
+
+/**
+ * struct graph_retired_s - Snapshot replaced by a newer one, waiting for
+ * its last readers
+ *
+ * @csr: The snapshot
+ * @epoch: Epoch of the publisher when the snapshot was replaced
+ */
+typedef struct graph_retired_s
+{
+	graph_csr_t *csr;
+	uint64_t epoch;
+} graph_retired_t;
+
+/**
+ * struct graph_publisher_s - Publishes immutable snapshots of a graph to
+ * concurrent readers, reclaiming them with epochs
+ * Readers only touch their own slot and @current, writers serialize on
+ * @lock
+ *
+ * @current: Latest published snapshot, or NULL
+ * @epoch: Epoch, incremented each time a snapshot is replaced
+ * @readers: Array of one slot per reader thread
+ * @nb_readers: Number of slots in @readers
+ * @retired: Array of replaced snapshots not freed yet
+ * @nb_retired: Number of snapshots in @retired
+ * @cap_retired: Number of snapshots @retired has room for
+ * @lock: Mutex held while publishing and reclaiming
+ */
+typedef struct graph_publisher_s
+{
+	graph_csr_t *current;
+	uint64_t epoch;
+	graph_reader_slot_t *readers;
+	size_t nb_readers;
+	graph_retired_t *retired;
+	size_t nb_retired;
+	size_t cap_retired;
+	pthread_mutex_t lock;
+} graph_publisher_t;
+
+/**
+ * struct graph_packed_cursor_s - Position in a compressed adjacency list
+ *
+ * @p: Next byte to decode
+ * @left: Number of neighbours not decoded yet
+ * @first: Non-zero until the first neighbour, stored relative to the
+ *   vertex itself, is decoded
+ * @prev: Last neighbour decoded, or the vertex itself
+ */
+typedef struct graph_packed_cursor_s
+{
+	const unsigned char *p;
+	size_t left;
+	int first;
+	size_t prev;
+} graph_packed_cursor_t;
+
+/**
+ * struct dfs_frame_s - Frame of the explicit stack of a depth-first search
+ *
+ * @vertex: Vertex being explored
+ * @edge: Next edge of @vertex to follow, NULL once they are all followed
+ */
+typedef struct dfs_frame_s
+{
+	const vertex_t *vertex;
+	const edge_t *edge;
+} dfs_frame_t;
+
+/**
+ * struct graph_dfs_iter_s - Pull-style depth-first iterator over a graph
+ * The depth of the vertex on top of the stack is size - 1
+ *
+ * @visited: Bitset of vertices already returned or about to be
+ * @stack: Array of frames, from the start vertex to the current one
+ * @size: Number of frames on the stack
+ * @capacity: Number of frames @stack has room for
+ * @pending: Start vertex until it has been returned, NULL afterwards
+ * @error: Set when the stack could not grow, the traversal is then
+ *   incomplete although graph_dfs_iter_next returns NULL
+ */
+typedef struct graph_dfs_iter_s
+{
+	uint64_t *visited;
+	dfs_frame_t *stack;
+	size_t size;
+	size_t capacity;
+	const vertex_t *pending;
+	int error;
+} graph_dfs_iter_t;
+
 /**
  * queue_node_s - Structure for a queue node
  * @vertex: Pointer to the graph vertex
@@ -84,10 +384,193 @@ typedef struct queue_node_s
 
 /* Graph functions */
 graph_t *graph_create(void);
+graph_t *graph_create_flags(unsigned int flags);
 vertex_t *graph_add_vertex(graph_t *graph, const char *content);
 int graph_add_edge(graph_t *graph, const char *src, const char *dest, edge_type_t type);
+int graph_has_edge(const graph_t *graph, const char *src, const char *dest);
+int graph_remove_edge(graph_t *graph, const char *src, const char *dest,
+		      edge_type_t type);
+int graph_remove_vertex(graph_t *graph, const char *content);
+size_t graph_compact(graph_t *graph);
 void graph_delete(graph_t *graph);
+size_t *graph_reorder(graph_t *graph, graph_order_t strategy);
+vertex_t *graph_find_vertex(const graph_t *graph, const char *content);
+vertex_t *graph_find_vertex_len(const graph_t *graph, const char *content,
+				size_t len);
+vertex_t *graph_add_vertex_len(graph_t *graph, const char *str, size_t len);
+graph_t *graph_load_edgelist(const char *path, unsigned int flags);
+vertex_id_t graph_intern(graph_t *graph, const char *content);
+vertex_id_t graph_vertex_id(const graph_t *graph, const char *content);
+vertex_t *graph_vertex_by_id(const graph_t *graph, vertex_id_t id);
+/* Float weights must be finite and not negative, others are rejected */
+int graph_add_weighted_edge(graph_t *graph, const char *src,
+			    const char *dest, graph_weight_t weight,
+			    edge_type_t type);
+int graph_add_weighted_edge_id(graph_t *graph, vertex_id_t src,
+			       vertex_id_t dest, graph_weight_t weight,
+			       edge_type_t type);
+int graph_add_edge_id(graph_t *graph, vertex_id_t src, vertex_id_t dest,
+		      edge_type_t type);
 size_t depth_first_traverse(const graph_t *graph, void (*action)(const vertex_t *v, size_t depth));
 size_t breadth_first_traverse(const graph_t *graph, void (*action)(const vertex_t *v, size_t depth));
+size_t depth_first_traverse_id(const graph_t *graph, vertex_id_t start,
+	void (*action)(vertex_id_t id, size_t depth));
+size_t breadth_first_traverse_id(const graph_t *graph, vertex_id_t start,
+	void (*action)(vertex_id_t id, size_t depth));
+
+/* Depth-first iterator */
+graph_dfs_iter_t *graph_dfs_iter_create(const graph_t *graph,
+					const vertex_t *start);
+const vertex_t *graph_dfs_iter_next(graph_dfs_iter_t *iter, size_t *depth);
+void graph_dfs_iter_delete(graph_dfs_iter_t *iter);
+
+/* Frozen CSR snapshots */
+graph_csr_t *graph_freeze(const graph_t *graph);
+void graph_csr_delete(graph_csr_t *csr);
+graph_csr_t *graph_csr_transpose(const graph_csr_t *csr);
+const vertex_t *graph_csr_vertex(const graph_csr_t *csr, size_t v,
+				 vertex_t *stub);
+const char *graph_csr_content(const graph_csr_t *csr, size_t v);
+int graph_csr_removed(const graph_csr_t *csr, size_t v);
+size_t graph_csr_first(const graph_csr_t *csr);
+int graph_save_binary(const graph_csr_t *csr, const char *path);
+graph_csr_t *graph_open_mapped(const char *path);
+graph_csr_t *graph_snapshot(const graph_t *graph);
+size_t csr_depth_first_traverse(const graph_csr_t *csr,
+	void (*action)(const vertex_t *v, size_t depth));
+size_t csr_breadth_first_traverse(const graph_csr_t *csr,
+	void (*action)(const vertex_t *v, size_t depth));
+size_t csr_breadth_first_traverse_do(const graph_csr_t *csr,
+	const graph_csr_t *rev,
+	void (*action)(const vertex_t *v, size_t depth));
+size_t breadth_first_traverse_do(const graph_t *graph,
+	void (*action)(const vertex_t *v, size_t depth));
+size_t csr_breadth_first_traverse_mt(const graph_csr_t *csr,
+	size_t nb_threads, size_t *depths,
+	void (*action)(const vertex_t *v, size_t depth));
+size_t csr_breadth_first_traverse_ms(const graph_csr_t *csr,
+	const size_t *sources, size_t nb_sources, size_t **depths);
+size_t breadth_first_traverse_ms(const graph_t *graph,
+	const vertex_t * const *sources, size_t nb_sources, size_t **depths);
+size_t breadth_first_traverse_ext(const char *path, size_t segment,
+	void (*action)(const vertex_t *v, size_t depth));
+size_t csr_pagerank(const graph_csr_t *csr, const graph_csr_t *rev,
+		    size_t nb_threads, double tolerance, double *ranks);
+size_t graph_pagerank(const graph_t *graph, size_t nb_threads,
+		      double tolerance, double *ranks);
+size_t csr_triangle_count(const graph_csr_t *csr);
+size_t graph_triangle_count(const graph_t *graph);
+size_t csr_strongly_connected_components(const graph_csr_t *csr,
+					 size_t *labels);
+size_t graph_strongly_connected_components(const graph_t *graph,
+					   size_t *labels);
+size_t csr_topological_sort(const graph_csr_t *csr, size_t *order);
+size_t graph_topological_sort(const graph_t *graph, size_t *order);
+size_t csr_connected_components(const graph_csr_t *csr, size_t nb_threads,
+				size_t *labels);
+size_t graph_connected_components(const graph_t *graph, size_t nb_threads,
+				  size_t *labels);
+
+/* Compressed snapshots */
+graph_packed_t *graph_pack(const graph_csr_t *csr);
+void graph_packed_delete(graph_packed_t *packed);
+size_t graph_packed_size(const graph_packed_t *packed);
+const vertex_t *graph_packed_vertex(const graph_packed_t *packed, size_t v,
+				    vertex_t *stub);
+size_t graph_packed_neighbours(const graph_packed_t *packed, size_t v,
+			       size_t *dests);
+size_t packed_depth_first_traverse(const graph_packed_t *packed,
+	void (*action)(const vertex_t *v, size_t depth));
+size_t packed_breadth_first_traverse(const graph_packed_t *packed,
+	void (*action)(const vertex_t *v, size_t depth));
+
+/* LEB128 varints, 7 bits per byte, the high bit set on all but the last */
+#define GRAPH_VARINT_MAX 10
+#define ZIGZAG(x) ((x) >= 0 ? (size_t)(x) << 1 : ((size_t)-((x) + 1) << 1) | 1)
+#define UNZIGZAG(u) ((u) & 1 ? -(long)((u) >> 1) - 1 : (long)((u) >> 1))
+
+/* PageRank parameters, see csr_pagerank */
+#define GRAPH_PAGERANK_DAMPING 0.85
+#define GRAPH_PAGERANK_MAX_ITERATIONS 100
+
+/* Snapshot publishing, for readers running while the graph changes */
+graph_publisher_t *graph_publisher_create(size_t nb_readers);
+void graph_publisher_delete(graph_publisher_t *pub);
+int graph_publish(graph_publisher_t *pub, const graph_t *graph);
+size_t graph_reclaim(graph_publisher_t *pub);
+const graph_csr_t *graph_reader_pin(graph_publisher_t *pub, size_t reader);
+void graph_reader_unpin(graph_publisher_t *pub, size_t reader);
+
+/* Edges per partition of breadth_first_traverse_ext, 8 MiB of indices */
+#define GRAPH_EXT_SEGMENT ((size_t)1 << 20)
+
+/* Binary snapshot files, see graph_save_binary */
+#define GRAPH_FILE_MAGIC "GRAPHCSR"
+#define GRAPH_FILE_VERSION 1
+#define GRAPH_FILE_BYTE_ORDER 0x01020304
+#define GRAPH_FILE_WEIGHTED 0x1
+#define GRAPH_FILE_WEIGHT_SHIFT 8
+
+/**
+ * struct graph_file_header_s - Header of a binary snapshot file
+ * It is followed by the offsets, dests and names arrays of the snapshot,
+ * stored as native size_t values, then by the weights array when @flags
+ * has GRAPH_FILE_WEIGHTED, then by the pool of vertex names
+ *
+ * @magic: GRAPH_FILE_MAGIC, without its NUL byte
+ * @version: GRAPH_FILE_VERSION
+ * @byte_order: GRAPH_FILE_BYTE_ORDER, as written by the saving machine
+ * @word_size: sizeof(size_t) on the saving machine
+ * @flags: Optional sections, 0 or GRAPH_FILE_WEIGHTED with the
+ *   GRAPH_WEIGHT_KIND of the saving build in bits 8 to 15
+ * @nb_vertices: Number of vertices in the snapshot
+ * @nb_edges: Number of directed edges in the snapshot
+ * @strings_size: Size in bytes of the pool of vertex names
+ */
+typedef struct graph_file_header_s
+{
+	char magic[8];
+	uint32_t version;
+	uint32_t byte_order;
+	uint32_t word_size;
+	uint32_t flags;
+	uint64_t nb_vertices;
+	uint64_t nb_edges;
+	uint64_t strings_size;
+} graph_file_header_t;
+
+/* Bitsets of vertex indices, stored in 64-bit words */
+#define BITSET_WORDS(n) (((n) + 63) / 64)
+#define BITSET_TEST(set, i) (((set)[(i) >> 6] >> ((i) & 63)) & 1)
+#define BITSET_SET(set, i) ((set)[(i) >> 6] |= (uint64_t)1 << ((i) & 63))
+
+/* Internal helpers */
+size_t graph_hash_content(const char *str, size_t len);
+size_t graph_hash_edge(const vertex_t *src, const vertex_t *dest);
+int graph_index_insert(graph_t *graph, vertex_t *vertex);
+void graph_index_rebuild(graph_t *graph);
+void graph_index_remove(graph_t *graph, const vertex_t *vertex);
+int graph_by_id_reserve(graph_t *graph);
+void graph_by_id_rebuild(graph_t *graph);
+int graph_edge_index_add(graph_t *graph, const vertex_t *src);
+void graph_edge_index_remove(graph_t *graph, const vertex_t *src,
+			     const vertex_t *dest);
+int graph_edge_index_rebuild(graph_t *graph);
+int graph_drop_duplicate_edges(graph_t *graph);
+int graph_edge_exists(const graph_t *graph, const vertex_t *src,
+		      const vertex_t *dest);
+void *graph_alloc(graph_t *graph, size_t size);
+char *graph_strndup(graph_t *graph, const char *str, size_t len);
+void graph_free_item(const graph_t *graph, void *ptr);
+void graph_slabs_free(graph_slab_t *slabs);
+void graph_free_storage(graph_t *graph);
+int graph_relocate(graph_t *graph, const graph_csr_t *csr,
+		   const size_t *order, const size_t *perm);
+int graph_add_edge_between(graph_t *graph, vertex_t *src, vertex_t *dest,
+			   graph_weight_t weight, edge_type_t type);
+int graph_parse_weight(const char *str, size_t len, graph_weight_t *weight);
+size_t graph_packed_open(const graph_packed_t *packed, size_t v,
+			 graph_packed_cursor_t *cursor);
+int graph_packed_next(graph_packed_cursor_t *cursor, size_t *dest);
 
 #endif
@@ -1,5 +1,4 @@
 #include <stdlib.h>
-#include <stdio.h>
 #include "pathfinding.h"
 #include "queues.h"
 
@@ -22,6 +21,7 @@ static int backtrack(char **map, char **visited, int rows, int cols,
 {
 	point_t *point;
 
+	PATH_TRACE_COUNT(relaxed, 1);
 	/* Check bounds */
 	if (x < 0 || x >= cols || y < 0 || y >= rows)
 		return (0);
@@ -30,8 +30,7 @@ static int backtrack(char **map, char **visited, int rows, int cols,
 	if (map[y][x] != '0' || visited[y][x])
 		return (0);
 
-	/* Print check */
-	printf("Checking coordinates [%d, %d]\n", x, y);
+	PATH_TRACE_EXPAND(NULL, NULL, (size_t)y * cols + x, x, y, 0);
 
 	/* Mark current cell as visited */
 	visited[y][x] = 1;
@@ -62,6 +61,7 @@ static int backtrack(char **map, char **visited, int rows, int cols,
 
 /**
  * backtracking_array - Finds a path from start to target using backtracking
+ * Every cell checked is reported to the trace hook, see path_trace_set
  *
  * @map: 2D array of chars representing the maze
  * @rows: number of rows
@@ -108,12 +108,14 @@ queue_t *backtracking_array(char **map, int rows, int cols,
 	}
 
 	/* Start recursive backtracking */
+	PATH_TRACE_BEGIN();
 	if (!backtrack(map, visited, rows, cols, start->x, start->y, target, path))
 	{
 		/* No path found, cleanup */
 		queue_delete(path);
 		path = NULL;
 	}
+	PATH_TRACE_END();
 
 	/* Cleanup visited matrix */
 	for (i = 0; i < rows; i++)
@@ -1,4 +1,3 @@
-#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include "pathfinding.h"
@@ -20,6 +19,7 @@ static int backtrack(vertex_t const *vertex, vertex_t const *target,
 
 	if (!vertex || !target || !visited || !path)
 		return (0);
+	PATH_TRACE_COUNT(relaxed, 1);
 
 	for (i = 0; i < count; i++)
 	{
@@ -27,7 +27,7 @@ static int backtrack(vertex_t const *vertex, vertex_t const *target,
 			return (0);
 	}
 
-	printf("Checking %s\n", vertex->content);
+	PATH_TRACE_EXPAND(vertex->content, NULL, vertex->index, 0, 0, 0);
 
 	visited[count] = (char *)vertex->content;
 	queue_push_back(path, strdup(vertex->content));
@@ -39,7 +39,8 @@ static int backtrack(vertex_t const *vertex, vertex_t const *target,
 
 	while (edge)
 	{
-		if (backtrack(edge->dest, target, visited, count + 1, path))
+		if (!GRAPH_VERTEX_REMOVED(edge->dest) &&
+		    backtrack(edge->dest, target, visited, count + 1, path))
 			return (1);
 		edge = edge->next;
 	}
@@ -50,6 +51,7 @@ static int backtrack(vertex_t const *vertex, vertex_t const *target,
 
 /**
  * backtracking_graph - Finds a path in a graph using backtracking.
+ * Every vertex checked is reported to the trace hook, see path_trace_set.
  * @graph: Pointer to the graph.
  * @start: Pointer to the starting vertex.
  * @target: Pointer to the target vertex.
@@ -59,6 +61,7 @@ queue_t *backtracking_graph(graph_t *graph, vertex_t const *start, vertex_t cons
 {
 	char **visited;
 	queue_t *path;
+	int found;
 
 	if (!graph || !start || !target)
 		return (NULL);
@@ -73,7 +76,10 @@ queue_t *backtracking_graph(graph_t *graph, vertex_t const *start, vertex_t cons
 		return (NULL);
 	}
 
-	if (!backtrack(start, target, visited, 0, path))
+	PATH_TRACE_BEGIN();
+	found = backtrack(start, target, visited, 0, path);
+	PATH_TRACE_END();
+	if (!found)
 	{
 		free(visited);
 		while (path->front)
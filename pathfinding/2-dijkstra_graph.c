@@ -1,152 +1,129 @@
 #include "pathfinding.h"
 #include <stdlib.h>
 #include <stdint.h>
-#include <stdio.h>
 #include <string.h>
-#include <limits.h>
-
-/**
- * struct dijkstra_node_s - Struct to store Dijkstra data
- * @vertex: Pointer to the graph vertex
- * @distance: Shortest known distance from the start
- * @prev: Pointer to previous vertex in the shortest path
- * @visited: Flag indicating if the vertex was visited
- */
-typedef struct dijkstra_node_s
-{
-	vertex_t *vertex;
-	size_t distance;
-	vertex_t *prev;
-	int visited;
-} dijkstra_node_t;
-
-/**
- * get_node_by_vertex - Finds the node data associated with a vertex
- * @nodes: Array of all dijkstra_node_t
- * @vertex: Target vertex
- * @size: Number of nodes
- * Return: Pointer to the found dijkstra_node_t, or NULL
- */
-static dijkstra_node_t *get_node_by_vertex(dijkstra_node_t *nodes,
-					   const vertex_t *vertex, size_t size)
-{
-	for (size_t i = 0; i < size; i++)
-		if (nodes[i].vertex == vertex)
-			return &nodes[i];
-	return (NULL);
-}
-
-/**
- * get_closest_unvisited - Finds the closest unvisited node
- * @nodes: Array of dijkstra_node_t
- * @size: Number of nodes
- * Return: Pointer to the closest unvisited node
- */
-static dijkstra_node_t *get_closest_unvisited(dijkstra_node_t *nodes, size_t size)
-{
-	dijkstra_node_t *min = NULL;
-
-	for (size_t i = 0; i < size; i++)
-	{
-		if (!nodes[i].visited &&
-		    (!min || nodes[i].distance < min->distance))
-			min = &nodes[i];
-	}
-	return (min);
-}
 
 /**
  * build_path - Builds path queue from target to start
- * @nodes: Dijkstra nodes
- * @size: Total number of nodes
+ * @graph: Pointer to the graph, whose by_id array maps indices to vertices
+ * @prev: Array mapping a vertex index to the index of its predecessor
  * @start: Starting vertex
  * @target: Target vertex
  * Return: Queue with the path, or NULL on failure
  */
-static queue_t *build_path(dijkstra_node_t *nodes, size_t size,
+static queue_t *build_path(const graph_t *graph, const size_t *prev,
 			   const vertex_t *start, const vertex_t *target)
 {
 	queue_t *path = queue_create();
-	dijkstra_node_t *node = get_node_by_vertex(nodes, target, size);
+	size_t v = target->index;
 	char *name;
 
 	if (!path)
 		return (NULL);
 
-	while (node)
+	while (1)
 	{
-		name = strdup(node->vertex->content);
+		name = strdup(graph->by_id[v]->content);
 		if (!name || !queue_push_front(path, name))
 		{
 			free(name);
 			queue_delete(path);
 			return (NULL);
 		}
-		if (node->vertex == start)
+		if (v == start->index)
 			break;
-		node = get_node_by_vertex(nodes, node->prev, size);
+		v = prev[v];
 	}
 	return (path);
 }
 
 /**
- * dijkstra_graph - Finds the shortest path using Dijkstra’s algorithm
+ * dijkstra_graph_run - Settles the vertices of a graph by increasing
+ * distance from a start vertex, until the target is settled
+ * Per-vertex state lives in arrays indexed by vertex_t.index, reached
+ * through graph->by_id, and the next vertex to settle comes from an
+ * indexed binary heap with decrease-key, so a query takes O((V + E) log V).
+ * Vertices at the same distance may be settled in any order. Edges weigh
+ * edge->weight. Every vertex settled is reported to the trace hook, see
+ * path_trace_set
  * @graph: Pointer to the graph
- * @start: Starting vertex
- * @target: Target vertex
- * Return: Queue with shortest path or NULL
+ * @start: Index of the starting vertex, not removed
+ * @target: Index of the target vertex
+ * @prev: Array of nb_vertices receiving the predecessor of each vertex
+ * on its shortest path
+ *
+ * Return: 1 if @target was reached, 0 if it was not or on failure
  */
-queue_t *dijkstra_graph(graph_t *graph, const vertex_t *start,
-			const vertex_t *target)
+int dijkstra_graph_run(graph_t const *graph, size_t start, size_t target,
+		       size_t *prev)
 {
-	vertex_t *v;
-	dijkstra_node_t *nodes;
-	dijkstra_node_t *current, *neighbor;
-	edge_t *edge;
-	size_t count = 0;
-
-	if (!graph || !start || !target)
-		return (NULL);
-
-	for (v = graph->vertices; v; v = v->next)
-		count++;
-
-	nodes = calloc(count, sizeof(*nodes));
-	if (!nodes)
-		return (NULL);
-
-	v = graph->vertices;
-	for (size_t i = 0; i < count; i++, v = v->next)
+	graph_dist_t *dist, d;
+	size_t v;
+	index_heap_t heap;
+	const edge_t *edge;
+	int found = 0;
+
+	dist = malloc(graph->nb_vertices * sizeof(*dist));
+	if (dist)
+		for (v = 0; v < graph->nb_vertices; v++)
+			dist[v] = GRAPH_DIST_MAX;
+	if (!dist || !index_heap_init(&heap, graph->nb_vertices, dist))
 	{
-		nodes[i].vertex = v;
-		nodes[i].distance = (v == start) ? 0 : SIZE_MAX;
-		nodes[i].prev = NULL;
-		nodes[i].visited = 0;
+		free(dist);
+		return (0);
 	}
+	PATH_TRACE_BEGIN();
+	dist[start] = 0;
+	index_heap_update(&heap, start);
 
-	while ((current = get_closest_unvisited(nodes, count)))
+	while (heap.size && !found)
 	{
-		current->visited = 1;
-		printf("Checking %s, distance from %s is %lu\n",
-		       current->vertex->content, start->content, current->distance);
-
-		if (current->vertex == target)
-			break;
-
-		for (edge = current->vertex->edges; edge; edge = edge->next)
+		v = index_heap_pop(&heap);
+		PATH_TRACE_EXPAND(graph->by_id[v]->content,
+				  graph->by_id[start]->content, v, 0, 0,
+				  dist[v]);
+		found = v == target;
+		for (edge = graph->by_id[v]->edges; !found && edge;
+		     edge = edge->next)
 		{
-			neighbor = get_node_by_vertex(nodes, edge->dest, count);
-			if (!neighbor || neighbor->visited)
+			PATH_TRACE_COUNT(relaxed, 1);
+			d = dist[v] + edge->weight;
+			if (GRAPH_VERTEX_REMOVED(edge->dest) ||
+			    d >= dist[edge->dest->index])
 				continue;
-			if (current->distance + edge->weight < neighbor->distance)
-			{
-				neighbor->distance = current->distance + edge->weight;
-				neighbor->prev = current->vertex;
-			}
+			dist[edge->dest->index] = d;
+			prev[edge->dest->index] = v;
+			index_heap_update(&heap, edge->dest->index);
 		}
 	}
+	PATH_TRACE_END();
+	index_heap_free(&heap);
+	free(dist);
+	return (found);
+}
+
+/**
+ * dijkstra_graph - Finds the shortest path using Dijkstra’s algorithm, see
+ * dijkstra_graph_run
+ * @graph: Pointer to the graph
+ * @start: Starting vertex
+ * @target: Target vertex
+ * Return: Queue with shortest path, or NULL if there is none or on failure
+ */
+queue_t *dijkstra_graph(graph_t *graph, const vertex_t *start,
+			const vertex_t *target)
+{
+	size_t *prev;
+	queue_t *path = NULL;
+
+	if (!graph || !start || !target || GRAPH_VERTEX_REMOVED(start) ||
+	    GRAPH_VERTEX_REMOVED(target))
+		return (NULL);
 
-	queue_t *path = build_path(nodes, count, start, target);
-	free(nodes);
+	prev = malloc(graph->nb_vertices * sizeof(*prev));
+	if (prev &&
+	    dijkstra_graph_run(graph, start->index, target->index, prev))
+		path = build_path(graph, prev, start, target);
+	free(prev);
 	return (path);
 }
@@ -0,0 +1,121 @@
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include "pathfinding.h"
+
+/**
+ * csr_build_path - Builds the path queue by walking predecessors back
+ * @csr: Snapshot the path was computed on
+ * @prev: Array mapping a vertex index to its predecessor index
+ * @start: Index of the starting vertex
+ * @target: Index of the target vertex
+ *
+ * Return: Queue with the path, or NULL on failure
+ */
+queue_t *csr_build_path(graph_csr_t const *csr, const size_t *prev,
+			size_t start, size_t target)
+{
+	queue_t *path = queue_create();
+	size_t v = target;
+	char *name;
+
+	if (!path)
+		return (NULL);
+
+	while (1)
+	{
+		name = strdup(graph_csr_content(csr, v));
+		if (!name || !queue_push_front(path, name))
+		{
+			free(name);
+			queue_delete(path);
+			return (NULL);
+		}
+		if (v == start)
+			break;
+		v = prev[v];
+	}
+	return (path);
+}
+
+/**
+ * dijkstra_csr_run - Settles the vertices of a CSR snapshot by increasing
+ * distance from a start vertex, until the target is settled
+ * Edges weigh their entry of csr->weights, or 1 when it is NULL. Every
+ * vertex settled is reported to the trace hook, see path_trace_set
+ * @csr: Pointer to the snapshot
+ * @start: Index of the starting vertex
+ * @target: Index of the target vertex
+ * @prev: Array of nb_vertices receiving the predecessor of each vertex
+ * on its shortest path
+ *
+ * Return: 1 if @target was reached, 0 if it was not or on failure
+ */
+int dijkstra_csr_run(graph_csr_t const *csr, size_t start, size_t target,
+		     size_t *prev)
+{
+	graph_dist_t *dist, d;
+	size_t v, e;
+	index_heap_t heap;
+	int found = 0;
+
+	dist = malloc(csr->nb_vertices * sizeof(*dist));
+	if (dist)
+		for (v = 0; v < csr->nb_vertices; v++)
+			dist[v] = GRAPH_DIST_MAX;
+	if (!dist || !index_heap_init(&heap, csr->nb_vertices, dist))
+	{
+		free(dist);
+		return (0);
+	}
+	PATH_TRACE_BEGIN();
+	dist[start] = 0;
+	index_heap_update(&heap, start);
+
+	while (heap.size && !found)
+	{
+		v = index_heap_pop(&heap);
+		PATH_TRACE_EXPAND(graph_csr_content(csr, v),
+				  graph_csr_content(csr, start), v, 0, 0,
+				  dist[v]);
+		found = v == target;
+		for (e = csr->offsets[v];
+		     !found && e < csr->offsets[v + 1]; e++)
+		{
+			PATH_TRACE_COUNT(relaxed, 1);
+			d = dist[v] + (csr->weights ? csr->weights[e] : 1);
+			if (d >= dist[csr->dests[e]])
+				continue;
+			dist[csr->dests[e]] = d;
+			prev[csr->dests[e]] = v;
+			index_heap_update(&heap, csr->dests[e]);
+		}
+	}
+	PATH_TRACE_END();
+	index_heap_free(&heap);
+	free(dist);
+	return (found);
+}
+
+/**
+ * dijkstra_csr - Finds the shortest path on a CSR snapshot
+ * Edges weigh their entry of csr->weights, or 1 when it is NULL
+ * @csr: Pointer to the snapshot
+ * @start: Index of the starting vertex
+ * @target: Index of the target vertex
+ *
+ * Return: Queue with shortest path, or NULL if there is none or on failure
+ */
+queue_t *dijkstra_csr(graph_csr_t const *csr, size_t start, size_t target)
+{
+	size_t *prev;
+	queue_t *path = NULL;
+
+	if (!csr || start >= csr->nb_vertices || target >= csr->nb_vertices)
+		return (NULL);
+	prev = malloc(csr->nb_vertices * sizeof(*prev));
+	if (prev && dijkstra_csr_run(csr, start, target, prev))
+		path = csr_build_path(csr, prev, start, target);
+	free(prev);
+	return (path);
+}
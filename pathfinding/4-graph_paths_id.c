@@ -0,0 +1,108 @@
+#include <stdlib.h>
+#include "pathfinding.h"
+
+/**
+ * path_from_prev - Builds the array of IDs of a path by walking
+ * predecessors back from its target
+ * @prev: Array mapping a vertex index to its predecessor index
+ * @start: ID of the starting vertex
+ * @target: ID of the target vertex
+ * @length: Receives the number of vertices in the path
+ *
+ * Return: Array of the IDs of the path, from @start to @target, or NULL
+ * on failure
+ */
+static vertex_id_t *path_from_prev(const size_t *prev, vertex_id_t start,
+				   vertex_id_t target, size_t *length)
+{
+	vertex_id_t *path;
+	size_t count = 1, v;
+
+	for (v = target; v != start; v = prev[v])
+		count++;
+	path = malloc(count * sizeof(*path));
+	if (!path)
+		return (NULL);
+	*length = count;
+	for (v = target; count--; v = prev[v])
+		path[count] = (vertex_id_t)v;
+	return (path);
+}
+
+/**
+ * backtracking_graph_id - Finds a path between two vertices given by their
+ * IDs, exploring the graph depth-first
+ * Unlike backtracking_graph, vertices are marked in a bitset rather than
+ * compared by name, and a vertex is never explored twice, so the search is
+ * linear in the size of the graph. Every vertex visited is reported to the
+ * trace hook, see path_trace_set
+ * @graph: Pointer to the graph
+ * @start: ID of the starting vertex
+ * @target: ID of the target vertex
+ * @length: Receives the number of vertices in the path
+ *
+ * Return: Array of the IDs of the path, from @start to @target, to be freed
+ * by the caller, or NULL if there is none or on failure
+ */
+vertex_id_t *backtracking_graph_id(graph_t *graph, vertex_id_t start,
+				   vertex_id_t target, size_t *length)
+{
+	graph_dfs_iter_t *iter;
+	const vertex_t *vertex;
+	vertex_id_t *path = NULL;
+	size_t i;
+
+	if (!graph_vertex_by_id(graph, start) ||
+	    !graph_vertex_by_id(graph, target) || !length)
+		return (NULL);
+	iter = graph_dfs_iter_create(graph, graph->by_id[start]);
+	if (!iter)
+		return (NULL);
+	PATH_TRACE_BEGIN();
+	while ((vertex = graph_dfs_iter_next(iter, NULL)))
+	{
+		PATH_TRACE_EXPAND(vertex->content, NULL, vertex->index,
+				  0, 0, 0);
+		if (vertex->index == target)
+			break;
+	}
+	PATH_TRACE_END();
+	/* The stack of the iterator holds the path to the current vertex */
+	if (vertex)
+		path = malloc(iter->size * sizeof(*path));
+	for (i = 0; path && i < iter->size; i++)
+		path[i] = (vertex_id_t)iter->stack[i].vertex->index;
+	if (path)
+		*length = iter->size;
+	graph_dfs_iter_delete(iter);
+	return (path);
+}
+
+/**
+ * dijkstra_graph_id - Finds the shortest path between two vertices given by
+ * their IDs
+ * The search runs on the adjacency lists, as dijkstra_graph does, see
+ * dijkstra_graph_run
+ * @graph: Pointer to the graph
+ * @start: ID of the starting vertex
+ * @target: ID of the target vertex
+ * @length: Receives the number of vertices in the path
+ *
+ * Return: Array of the IDs of the path, from @start to @target, to be freed
+ * by the caller, or NULL if there is none or on failure
+ */
+vertex_id_t *dijkstra_graph_id(graph_t *graph, vertex_id_t start,
+			       vertex_id_t target, size_t *length)
+{
+	size_t *prev;
+	vertex_id_t *path = NULL;
+
+	if (!graph_vertex_by_id(graph, start) ||
+	    !graph_vertex_by_id(graph, target) || !length)
+		return (NULL);
+	prev = malloc(graph->nb_vertices * sizeof(*prev));
+	if (prev && dijkstra_graph_run(graph, start, target, prev))
+		path = path_from_prev(prev, start, target, length);
+	free(prev);
+	return (path);
+}
@@ -0,0 +1,98 @@
+#include <stdlib.h>
+#include <stdint.h>
+#include "pathfinding.h"
+
+/**
+ * dag_csr_run - Computes shortest paths from a start vertex on an acyclic
+ * CSR snapshot, relaxing the edges of each vertex in topological order
+ * Every predecessor of a vertex comes before it in @order, so its distance
+ * is final once it is reached: no heap is needed and the run is linear.
+ * Edges weigh their entry of csr->weights, or 1 when it is NULL. Every
+ * vertex reached is reported to the trace hook, see path_trace_set
+ * @csr: Pointer to the snapshot
+ * @order: Array of the nb_vertices indices in topological order, as
+ * filled by csr_topological_sort
+ * @start: Index of the starting vertex
+ * @target: Index of the target vertex
+ * @prev: Array of nb_vertices receiving the predecessor of each vertex
+ * on its shortest path
+ *
+ * Return: 1 if @target was reached, 0 if it was not or on failure
+ */
+int dag_csr_run(graph_csr_t const *csr, const size_t *order, size_t start,
+		size_t target, size_t *prev)
+{
+	graph_dist_t *dist, d;
+	size_t i = 0, v, e;
+	int found = 0;
+
+	dist = malloc(csr->nb_vertices * sizeof(*dist));
+	if (!dist)
+		return (0);
+	for (v = 0; v < csr->nb_vertices; v++)
+		dist[v] = GRAPH_DIST_MAX;
+	PATH_TRACE_BEGIN();
+	dist[start] = 0;
+	while (order[i] != start)
+		i++;
+	for (; i < csr->nb_vertices && !found; i++)
+	{
+		v = order[i];
+		if (dist[v] == GRAPH_DIST_MAX)
+			continue;
+		PATH_TRACE_EXPAND(graph_csr_content(csr, v),
+				  graph_csr_content(csr, start), v, 0, 0,
+				  dist[v]);
+		found = v == target;
+		for (e = csr->offsets[v];
+		     !found && e < csr->offsets[v + 1]; e++)
+		{
+			PATH_TRACE_COUNT(relaxed, 1);
+			d = dist[v] + (csr->weights ? csr->weights[e] : 1);
+			if (d >= dist[csr->dests[e]])
+				continue;
+			dist[csr->dests[e]] = d;
+			prev[csr->dests[e]] = v;
+		}
+	}
+	PATH_TRACE_END();
+	free(dist);
+	return (found);
+}
+
+/**
+ * dag_shortest_path_csr - Finds the shortest path on a CSR snapshot,
+ * in linear time when it is acyclic
+ * The snapshot is sorted topologically first. If it has a cycle, the
+ * search falls back to dijkstra_csr_run.
+ * Edges weigh their entry of csr->weights, or 1 when it is NULL
+ * @csr: Pointer to the snapshot
+ * @start: Index of the starting vertex
+ * @target: Index of the target vertex
+ *
+ * Return: Queue with shortest path, or NULL if there is none or on failure
+ */
+queue_t *dag_shortest_path_csr(graph_csr_t const *csr, size_t start,
+			       size_t target)
+{
+	size_t *prev, *order;
+	queue_t *path = NULL;
+	int found;
+
+	if (!csr || start >= csr->nb_vertices || target >= csr->nb_vertices)
+		return (NULL);
+	prev = malloc(csr->nb_vertices * sizeof(*prev));
+	order = malloc(csr->nb_vertices * sizeof(*order));
+	if (prev && order)
+	{
+		if (csr_topological_sort(csr, order) == csr->nb_vertices)
+			found = dag_csr_run(csr, order, start, target, prev);
+		else
+			found = dijkstra_csr_run(csr, start, target, prev);
+		if (found)
+			path = csr_build_path(csr, prev, start, target);
+	}
+	free(prev);
+	free(order);
+	return (path);
+}
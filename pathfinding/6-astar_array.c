@@ -0,0 +1,186 @@
+#include <stdlib.h>
+#include <stdint.h>
+#include "pathfinding.h"
+
+/**
+ * grid_heuristic - Estimates the cost from a cell to the target, never
+ * overestimating it
+ * @x: X coordinate of the cell
+ * @y: Y coordinate of the cell
+ * @target: Pointer to the target point
+ * @moves: Moves allowed, GRID_4 for the Manhattan distance, GRID_8 for the
+ * octile distance
+ *
+ * Return: The estimated cost
+ */
+uint32_t grid_heuristic(int x, int y, point_t const *target,
+			grid_moves_t moves)
+{
+	uint32_t dx = abs(target->x - x), dy = abs(target->y - y);
+
+	if (moves == GRID_4)
+		return (GRID_COST_STRAIGHT * (dx + dy));
+	if (dx < dy)
+		return (GRID_COST_STRAIGHT * dy +
+			(GRID_COST_DIAGONAL - GRID_COST_STRAIGHT) * dx);
+	return (GRID_COST_STRAIGHT * dx +
+		(GRID_COST_DIAGONAL - GRID_COST_STRAIGHT) * dy);
+}
+
+/**
+ * push_point - Prepends a cell to a path
+ * @path: Pointer to the path queue
+ * @x: X coordinate of the cell
+ * @y: Y coordinate of the cell
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int push_point(queue_t *path, int x, int y)
+{
+	point_t *point = malloc(sizeof(*point));
+
+	if (!point || !queue_push_front(path, point))
+	{
+		free(point);
+		return (0);
+	}
+	point->x = x;
+	point->y = y;
+	return (1);
+}
+
+/**
+ * grid_build_path - Builds the path queue by walking parents back from
+ * the target
+ * Parents may be several cells away along a straight or diagonal line, as
+ * with jump point search, every cell in between is part of the path
+ * @search: State of the search that reached the cell
+ * @cell: Index of the target cell
+ *
+ * Return: Queue of point_t with the path, or NULL on failure
+ */
+queue_t *grid_build_path(const grid_search_t *search, uint32_t cell)
+{
+	queue_t *path = queue_create();
+	int x = cell % search->cols, y = cell / search->cols, px, py, ok;
+
+	ok = path && push_point(path, x, y);
+	while (ok && search->parent[cell] != cell)
+	{
+		cell = search->parent[cell];
+		px = cell % search->cols;
+		py = cell / search->cols;
+		while (ok && (x != px || y != py))
+		{
+			x += (px > x) - (px < x);
+			y += (py > y) - (py < y);
+			ok = push_point(path, x, y);
+		}
+	}
+	if (!ok && path)
+	{
+		queue_delete(path);
+		return (NULL);
+	}
+	return (path);
+}
+
+/**
+ * astar_grid - Finds a shortest path on a grid map using A*
+ * Cells are expanded by increasing estimated total cost, ties going to
+ * the cell closest to the target. Every cell expanded is reported to the
+ * trace hook, see path_trace_set
+ * @search: State created for the size of @map, reused across searches
+ * @map: 2D array of chars, '0' for a free cell
+ * @start: Pointer to the starting point
+ * @target: Pointer to the target point
+ * @moves: GRID_4 or GRID_8
+ *
+ * Return: Queue of point_t with the path, both ends included, or NULL if
+ * there is none or on failure
+ */
+queue_t *astar_grid(grid_search_t *search, char **map, point_t const *start,
+		    point_t const *target, grid_moves_t moves)
+{
+	static const int dx[8] = {1, 0, -1, 0, 1, -1, -1, 1};
+	static const int dy[8] = {0, 1, 0, -1, 1, 1, -1, -1};
+	uint32_t cell, next, g, goal;
+	int i, x, y, nx, ny, ok;
+	queue_t *path = NULL;
+
+	if (!search || !map || !start || !target ||
+	    !GRID_FREE(map, search, start->x, start->y) ||
+	    !GRID_FREE(map, search, target->x, target->y))
+		return (NULL);
+	grid_search_reset(search);
+	goal = (uint32_t)target->y * search->cols + target->x;
+	cell = (uint32_t)start->y * search->cols + start->x;
+	search->g[cell] = 0;
+	search->parent[cell] = cell;
+	search->stamp[cell] = 2 * search->gen;
+	PATH_TRACE_BEGIN();
+	ok = grid_open_push(search, cell,
+			    grid_heuristic(start->x, start->y, target, moves));
+	while (ok && (cell = grid_open_pop(search)) != GRID_NONE)
+	{
+		x = cell % search->cols;
+		y = cell / search->cols;
+		PATH_TRACE_EXPAND(NULL, NULL, cell, x, y, search->g[cell]);
+		if (cell == goal)
+		{
+			path = grid_build_path(search, goal);
+			break;
+		}
+		search->stamp[cell] = 2 * search->gen + 1;
+		for (i = 0; ok && i < (moves == GRID_8 ? 8 : 4); i++)
+		{
+			PATH_TRACE_COUNT(relaxed, 1);
+			nx = x + dx[i];
+			ny = y + dy[i];
+			if (!GRID_FREE(map, search, nx, ny) || (i >= 4 &&
+			    (!GRID_FREE(map, search, nx, y) ||
+			     !GRID_FREE(map, search, x, ny))))
+				continue;
+			next = (uint32_t)ny * search->cols + nx;
+			g = search->g[cell] + (i < 4 ? GRID_COST_STRAIGHT :
+					       GRID_COST_DIAGONAL);
+			if (GRID_OPENED(search, next) && g >= search->g[next])
+				continue;
+			search->g[next] = g;
+			search->parent[next] = cell;
+			search->stamp[next] = 2 * search->gen;
+			ok = grid_open_push(search, next, g +
+					    grid_heuristic(nx, ny, target,
+							   moves));
+		}
+	}
+	PATH_TRACE_END();
+	return (path);
+}
+
+/**
+ * astar_array - Finds a shortest path on a grid map using A*, see
+ * astar_grid
+ * The search state is allocated for this query only, servers answering
+ * many queries on one map should keep it with grid_search_create
+ * @map: 2D array of chars, '0' for a free cell
+ * @rows: Number of rows
+ * @cols: Number of columns
+ * @start: Pointer to the starting point
+ * @target: Pointer to the target point
+ * @moves: GRID_4 or GRID_8
+ *
+ * Return: Queue of point_t with the path, or NULL if there is none or on
+ * failure
+ */
+queue_t *astar_array(char **map, int rows, int cols, point_t const *start,
+		     point_t const *target, grid_moves_t moves)
+{
+	grid_search_t *search;
+	queue_t *path;
+
+	search = grid_search_create(rows, cols);
+	path = astar_grid(search, map, start, target, moves);
+	grid_search_delete(search);
+	return (path);
+}
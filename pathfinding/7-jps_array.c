@@ -0,0 +1,227 @@
+#include <stdlib.h>
+#include <stdint.h>
+#include "pathfinding.h"
+
+/**
+ * jump - Moves from a cell in one direction until a jump point is found
+ * A jump point is the target, a cell with a forced neighbour, that is a
+ * neighbour only reachable optimally through it, or, on a diagonal, a cell
+ * from which a straight jump finds one
+ * @search: State of the search, for the size of the map
+ * @map: 2D array of chars, '0' for a free cell
+ * @target: Pointer to the target point
+ * @p: Pointer to the cell to move from, set to the jump point
+ * @dx: Horizontal direction, -1, 0 or 1
+ * @dy: Vertical direction, -1, 0 or 1
+ *
+ * Return: 1 if a jump point was found, 0 if an obstacle was hit first
+ */
+static int jump(const grid_search_t *search, char **map,
+		point_t const *target, point_t *p, int dx, int dy)
+{
+	point_t side;
+	int x = p->x, y = p->y;
+
+	while (GRID_FREE(map, search, x + dx, y + dy) && (!dx || !dy ||
+	       (GRID_FREE(map, search, x + dx, y) &&
+		GRID_FREE(map, search, x, y + dy))))
+	{
+		x += dx;
+		y += dy;
+		p->x = x;
+		p->y = y;
+		if (x == target->x && y == target->y)
+			return (1);
+		if (dx && dy)
+		{
+			side = *p;
+			if (jump(search, map, target, &side, dx, 0))
+				return (1);
+			side = *p;
+			if (jump(search, map, target, &side, 0, dy))
+				return (1);
+		}
+		else if (dx && ((GRID_FREE(map, search, x, y - 1) &&
+				 !GRID_FREE(map, search, x - dx, y - 1)) ||
+				(GRID_FREE(map, search, x, y + 1) &&
+				 !GRID_FREE(map, search, x - dx, y + 1))))
+			return (1);
+		else if (dy && ((GRID_FREE(map, search, x - 1, y) &&
+				 !GRID_FREE(map, search, x - 1, y - dy)) ||
+				(GRID_FREE(map, search, x + 1, y) &&
+				 !GRID_FREE(map, search, x + 1, y - dy))))
+			return (1);
+	}
+	return (0);
+}
+
+/**
+ * add_dir - Appends a direction to a list if it is worth jumping to
+ * @dirs: Array of (dx, dy) pairs
+ * @n: Number of pairs in @dirs
+ * @dx: Horizontal direction
+ * @dy: Vertical direction
+ * @ok: Whether to append it
+ *
+ * Return: The new number of pairs
+ */
+static int add_dir(int *dirs, int n, int dx, int dy, int ok)
+{
+	if (!ok)
+		return (n);
+	dirs[2 * n] = dx;
+	dirs[2 * n + 1] = dy;
+	return (n + 1);
+}
+
+/**
+ * successors - Lists the directions worth jumping to from a cell
+ * Only the natural and forced neighbours, given the direction the cell was
+ * reached from, are kept. A straight move only turns towards a free side
+ * whose cell behind is blocked, the forced neighbour jump stops on. Every
+ * direction is tried from the start
+ * @search: State of the search
+ * @map: 2D array of chars, '0' for a free cell
+ * @cell: Index of the cell
+ * @dirs: Array of 16 receiving the (dx, dy) pairs
+ *
+ * Return: Number of directions
+ */
+static int successors(const grid_search_t *search, char **map, uint32_t cell,
+		      int *dirs)
+{
+	int x = cell % search->cols, y = cell / search->cols, n = 0, s;
+	int dx = x - (int)(search->parent[cell] % search->cols);
+	int dy = y - (int)(search->parent[cell] / search->cols);
+	int ox, oy, next, side;
+
+	dx = (dx > 0) - (dx < 0);
+	dy = (dy > 0) - (dy < 0);
+	if (!dx && !dy)
+	{
+		for (s = 0; s < 9; s++)
+			n = add_dir(dirs, n, s % 3 - 1, s / 3 - 1, s != 4);
+		return (n);
+	}
+	if (dx && dy)
+	{
+		next = GRID_FREE(map, search, x + dx, y);
+		side = GRID_FREE(map, search, x, y + dy);
+		n = add_dir(dirs, n, dx, 0, next);
+		n = add_dir(dirs, n, 0, dy, side);
+		return (add_dir(dirs, n, dx, dy, next && side));
+	}
+	ox = dy != 0;
+	oy = dx != 0;
+	next = GRID_FREE(map, search, x + dx, y + dy);
+	n = add_dir(dirs, n, dx, dy, next);
+	for (s = -1; s <= 1; s += 2)
+	{
+		side = GRID_FREE(map, search, x + s * ox, y + s * oy) &&
+			!GRID_FREE(map, search, x + s * ox - dx,
+				   y + s * oy - dy);
+		n = add_dir(dirs, n, dx + s * ox, dy + s * oy, next && side);
+		n = add_dir(dirs, n, s * ox, s * oy, side);
+	}
+	return (n);
+}
+
+/**
+ * jps_grid - Finds a shortest path on a grid map using jump point search
+ * This is A* with GRID_8 moves, see astar_grid, that only opens jump
+ * points: straight and diagonal runs with nothing to decide along them are
+ * crossed without touching the open list, and expanded back into single
+ * steps in the path. It returns paths as short as astar_grid does. Every
+ * jump point expanded is reported to the trace hook, and every jump counts
+ * as one relaxed move. The scans still read every cell they cross: long
+ * queries on 4096x4096 maps take hundreds of milliseconds, and open maps
+ * are its worst case, where astar_grid is faster
+ * @search: State created for the size of @map, reused across searches
+ * @map: 2D array of chars, '0' for a free cell
+ * @start: Pointer to the starting point
+ * @target: Pointer to the target point
+ *
+ * Return: Queue of point_t with the path, both ends included, or NULL if
+ * there is none or on failure
+ */
+queue_t *jps_grid(grid_search_t *search, char **map, point_t const *start,
+		  point_t const *target)
+{
+	uint32_t cell, next, g, goal;
+	int dirs[16], i, n, ok;
+	point_t from, to;
+	queue_t *path = NULL;
+
+	if (!search || !map || !start || !target ||
+	    !GRID_FREE(map, search, start->x, start->y) ||
+	    !GRID_FREE(map, search, target->x, target->y))
+		return (NULL);
+	grid_search_reset(search);
+	goal = (uint32_t)target->y * search->cols + target->x;
+	cell = (uint32_t)start->y * search->cols + start->x;
+	search->g[cell] = 0;
+	search->parent[cell] = cell;
+	search->stamp[cell] = 2 * search->gen;
+	PATH_TRACE_BEGIN();
+	ok = grid_open_push(search, cell,
+			    grid_heuristic(start->x, start->y, target, GRID_8));
+	while (ok && (cell = grid_open_pop(search)) != GRID_NONE)
+	{
+		from.x = cell % search->cols;
+		from.y = cell / search->cols;
+		PATH_TRACE_EXPAND(NULL, NULL, cell, from.x, from.y,
+				  search->g[cell]);
+		if (cell == goal)
+		{
+			path = grid_build_path(search, goal);
+			break;
+		}
+		search->stamp[cell] = 2 * search->gen + 1;
+		n = successors(search, map, cell, dirs);
+		for (i = 0; ok && i < n; i++)
+		{
+			PATH_TRACE_COUNT(relaxed, 1);
+			to = from;
+			if (!jump(search, map, target, &to, dirs[2 * i],
+				  dirs[2 * i + 1]))
+				continue;
+			next = (uint32_t)to.y * search->cols + to.x;
+			g = search->g[cell] +
+				grid_heuristic(from.x, from.y, &to, GRID_8);
+			if (GRID_OPENED(search, next) && g >= search->g[next])
+				continue;
+			search->g[next] = g;
+			search->parent[next] = cell;
+			search->stamp[next] = 2 * search->gen;
+			ok = grid_open_push(search, next, g +
+					    grid_heuristic(to.x, to.y, target,
+							   GRID_8));
+		}
+	}
+	PATH_TRACE_END();
+	return (path);
+}
+
+/**
+ * jps_array - Finds a shortest path on a grid map using jump point search,
+ * see jps_grid
+ * @map: 2D array of chars, '0' for a free cell
+ * @rows: Number of rows
+ * @cols: Number of columns
+ * @start: Pointer to the starting point
+ * @target: Pointer to the target point
+ *
+ * Return: Queue of point_t with the path, or NULL if there is none or on
+ * failure
+ */
+queue_t *jps_array(char **map, int rows, int cols, point_t const *start,
+		   point_t const *target)
+{
+	grid_search_t *search;
+	queue_t *path;
+
+	search = grid_search_create(rows, cols);
+	path = jps_grid(search, map, start, target);
+	grid_search_delete(search);
+	return (path);
+}
@@ -0,0 +1,217 @@
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include "pathfinding.h"
+
+/**
+ * struct bidi_side_s - State of one direction of a bidirectional search
+ *
+ * @csr: Snapshot searched, the graph forward or its transpose backward
+ * @root: Index of the vertex this direction starts from
+ * @dist: Array of the best known distance of each vertex from @root
+ * @link: Array of the vertex each vertex was reached from
+ * @heap: Vertices reached but not settled yet, by distance
+ */
+typedef struct bidi_side_s
+{
+	const graph_csr_t *csr;
+	size_t root;
+	graph_dist_t *dist;
+	size_t *link;
+	index_heap_t heap;
+} bidi_side_t;
+
+/**
+ * bidirectional_join - Appends the backward half of a path to the forward
+ * one, so that predecessors lead from the target back to the start
+ * With edges of weight 0, both halves may cross before the meeting vertex:
+ * the path then meets at the last vertex they share, to stay acyclic
+ * @prev: Array of predecessors of the forward search, start linked to itself
+ * @next: Array of successors of the backward search, target linked to
+ * itself
+ * @nb_vertices: Number of vertices
+ * @meet: Index of a vertex reached by both searches
+ * @target: Index of the target vertex
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int bidirectional_join(size_t *prev, const size_t *next, size_t nb_vertices,
+		       size_t meet, size_t target)
+{
+	uint64_t *forward = calloc(BITSET_WORDS(nb_vertices), sizeof(*forward));
+	size_t v;
+
+	if (!forward)
+		return (0);
+	for (v = meet; prev[v] != v; v = prev[v])
+		BITSET_SET(forward, v);
+	BITSET_SET(forward, v);
+	for (v = meet; v != target; v = next[v])
+		if (BITSET_TEST(forward, next[v]))
+			meet = next[v];
+	for (v = meet; v != target; v = next[v])
+		prev[next[v]] = v;
+	free(forward);
+	return (1);
+}
+
+/**
+ * side_init - Starts one direction of a bidirectional search
+ * @side: Pointer to the state, zeroed
+ * @csr: Snapshot to search
+ * @root: Index of the vertex to start from
+ * @link: Array of nb_vertices receiving the links of the search
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int side_init(bidi_side_t *side, const graph_csr_t *csr, size_t root,
+		     size_t *link)
+{
+	size_t v;
+
+	side->csr = csr;
+	side->root = root;
+	side->link = link;
+	side->dist = malloc(csr->nb_vertices * sizeof(*side->dist));
+	if (!side->dist)
+		return (0);
+	for (v = 0; v < csr->nb_vertices; v++)
+		side->dist[v] = GRAPH_DIST_MAX;
+	if (!index_heap_init(&side->heap, csr->nb_vertices, side->dist))
+		return (0);
+	side->dist[root] = 0;
+	link[root] = root;
+	index_heap_update(&side->heap, root);
+	return (1);
+}
+
+/**
+ * scan - Settles the closest vertex of one direction and relaxes its edges
+ * Every edge reaching a vertex the other direction has reached closes a
+ * path, the shortest one so far is kept
+ * @side: Pointer to the direction to advance
+ * @other: Pointer to the other direction
+ * @mu: Pointer to the length of the shortest path found so far
+ * @meet: Pointer to the vertex that path goes through
+ */
+static void scan(bidi_side_t *side, const bidi_side_t *other,
+		 graph_dist_t *mu, size_t *meet)
+{
+	const graph_csr_t *csr = side->csr;
+	size_t v = index_heap_pop(&side->heap), w, e;
+	graph_dist_t d;
+
+	PATH_TRACE_EXPAND(graph_csr_content(csr, v),
+			  graph_csr_content(csr, side->root), v, 0, 0,
+			  side->dist[v]);
+	for (e = csr->offsets[v]; e < csr->offsets[v + 1]; e++)
+	{
+		PATH_TRACE_COUNT(relaxed, 1);
+		w = csr->dests[e];
+		d = side->dist[v] + (csr->weights ? csr->weights[e] : 1);
+		if (d < side->dist[w])
+		{
+			side->dist[w] = d;
+			side->link[w] = v;
+			index_heap_update(&side->heap, w);
+		}
+		if (other->dist[w] != GRAPH_DIST_MAX &&
+		    side->dist[w] + other->dist[w] < *mu)
+		{
+			*mu = side->dist[w] + other->dist[w];
+			*meet = w;
+		}
+	}
+}
+
+/**
+ * bidirectional_dijkstra_run - Finds a shortest path on a CSR snapshot,
+ * searching forward from the start and backward from the target at once
+ * The direction with the fewest vertices in its heap advances, until the
+ * distances at the top of both heaps add up to at least the shortest path
+ * found, which is then optimal. Both searches together usually settle far
+ * fewer vertices than dijkstra_csr_run. Edges weigh their entry of the
+ * weights array, or 1 when it is NULL
+ * @csr: Pointer to the snapshot
+ * @rev: Pointer to its transpose, see graph_csr_transpose
+ * @start: Index of the starting vertex
+ * @target: Index of the target vertex
+ * @prev: Array of nb_vertices receiving the predecessor of each vertex
+ * of the path, as dijkstra_csr_run fills it
+ *
+ * Return: 1 if @target was reached, 0 if it was not or on failure
+ */
+int bidirectional_dijkstra_run(graph_csr_t const *csr, graph_csr_t const *rev,
+			       size_t start, size_t target, size_t *prev)
+{
+	bidi_side_t fwd, bwd;
+	size_t *next, meet = SIZE_MAX;
+	graph_dist_t mu = GRAPH_DIST_MAX;
+	int ok;
+
+	memset(&fwd, 0, sizeof(fwd));
+	memset(&bwd, 0, sizeof(bwd));
+	next = malloc(csr->nb_vertices * sizeof(*next));
+	ok = next && side_init(&fwd, csr, start, prev) &&
+		side_init(&bwd, rev, target, next);
+	PATH_TRACE_BEGIN();
+	if (ok && start == target)
+	{
+		meet = start;
+		mu = 0;
+	}
+	while (ok && fwd.heap.size && bwd.heap.size &&
+	       fwd.dist[fwd.heap.items[0]] + bwd.dist[bwd.heap.items[0]] < mu)
+	{
+		if (fwd.heap.size <= bwd.heap.size)
+			scan(&fwd, &bwd, &mu, &meet);
+		else
+			scan(&bwd, &fwd, &mu, &meet);
+	}
+	ok = ok && meet != SIZE_MAX &&
+		bidirectional_join(prev, next, csr->nb_vertices, meet, target);
+	PATH_TRACE_END();
+	index_heap_free(&fwd.heap);
+	index_heap_free(&bwd.heap);
+	free(fwd.dist);
+	free(bwd.dist);
+	free(next);
+	return (ok);
+}
+
+/**
+ * bidirectional_dijkstra_csr - Finds the shortest path on a CSR snapshot,
+ * see bidirectional_dijkstra_run
+ * The transpose holds the incoming edges the backward search follows.
+ * Servers answering many queries should build it once with
+ * graph_csr_transpose, otherwise it is built for this query only
+ * @csr: Pointer to the snapshot
+ * @rev: Pointer to the transpose of @csr, or NULL
+ * @start: Index of the starting vertex
+ * @target: Index of the target vertex
+ *
+ * Return: Queue with shortest path, or NULL if there is none or on failure
+ */
+queue_t *bidirectional_dijkstra_csr(graph_csr_t const *csr,
+				    graph_csr_t const *rev, size_t start,
+				    size_t target)
+{
+	graph_csr_t *own = NULL;
+	size_t *prev;
+	queue_t *path = NULL;
+
+	if (!csr || start >= csr->nb_vertices || target >= csr->nb_vertices ||
+	    (rev && (rev->nb_vertices != csr->nb_vertices ||
+		     rev->nb_edges != csr->nb_edges ||
+		     !rev->weights != !csr->weights)))
+		return (NULL);
+	if (!rev)
+		rev = own = graph_csr_transpose(csr);
+	prev = malloc(csr->nb_vertices * sizeof(*prev));
+	if (rev && prev &&
+	    bidirectional_dijkstra_run(csr, rev, start, target, prev))
+		path = csr_build_path(csr, prev, start, target);
+	free(prev);
+	graph_csr_delete(own);
+	return (path);
+}
@@ -0,0 +1,148 @@
+#include <stdlib.h>
+#include <stdint.h>
+#include "pathfinding.h"
+
+/**
+ * struct bfs_side_s - State of one direction of a bidirectional
+ * breadth-first search
+ *
+ * @csr: Snapshot searched, the graph forward or its transpose backward
+ * @link: Array of the vertex each vertex was reached from, or SIZE_MAX
+ * @queue: Array of the vertices reached, in the order they were
+ * @head: Position in @queue of the next vertex to expand
+ * @tail: Number of vertices in @queue
+ */
+typedef struct bfs_side_s
+{
+	const graph_csr_t *csr;
+	size_t *link;
+	size_t *queue;
+	size_t head;
+	size_t tail;
+} bfs_side_t;
+
+/**
+ * expand_layer - Expands every vertex of the frontier of one direction
+ * Layers are expanded whole, so the first vertex found that the other
+ * direction has reached closes a path with the fewest edges
+ * @side: Pointer to the direction to advance
+ * @other: Pointer to the other direction
+ *
+ * Return: Index of the vertex both directions reached, or SIZE_MAX
+ */
+static size_t expand_layer(bfs_side_t *side, const bfs_side_t *other)
+{
+	const graph_csr_t *csr = side->csr;
+	size_t end = side->tail, v, w, e;
+
+	for (; side->head < end; side->head++)
+	{
+		v = side->queue[side->head];
+		PATH_TRACE_EXPAND(graph_csr_content(csr, v), NULL, v, 0, 0, 0);
+		for (e = csr->offsets[v]; e < csr->offsets[v + 1]; e++)
+		{
+			PATH_TRACE_COUNT(relaxed, 1);
+			w = csr->dests[e];
+			if (side->link[w] != SIZE_MAX)
+				continue;
+			side->link[w] = v;
+			side->queue[side->tail++] = w;
+			if (other->link[w] != SIZE_MAX)
+				return (w);
+		}
+	}
+	return (SIZE_MAX);
+}
+
+/**
+ * bidirectional_bfs_run - Finds a path with the fewest edges on a CSR
+ * snapshot, searching forward from the start and backward from the target
+ * at once
+ * The direction with the smallest frontier expands its next layer, until
+ * a vertex is reached by both. Weights are ignored
+ * @csr: Pointer to the snapshot
+ * @rev: Pointer to its transpose, see graph_csr_transpose
+ * @start: Index of the starting vertex
+ * @target: Index of the target vertex
+ * @prev: Array of nb_vertices receiving the predecessor of each vertex
+ * of the path, as dijkstra_csr_run fills it
+ *
+ * Return: 1 if @target was reached, 0 if it was not or on failure
+ */
+int bidirectional_bfs_run(graph_csr_t const *csr, graph_csr_t const *rev,
+			  size_t start, size_t target, size_t *prev)
+{
+	size_t n = csr->nb_vertices, *next, *queues, v, meet = SIZE_MAX;
+	bfs_side_t fwd, bwd;
+	int ok;
+
+	next = malloc(n * sizeof(*next));
+	queues = malloc(2 * n * sizeof(*queues));
+	if (!next || !queues)
+	{
+		free(next);
+		free(queues);
+		return (0);
+	}
+	for (v = 0; v < n; v++)
+		prev[v] = next[v] = SIZE_MAX;
+	fwd.csr = csr;
+	fwd.link = prev;
+	fwd.queue = queues;
+	bwd.csr = rev;
+	bwd.link = next;
+	bwd.queue = queues + n;
+	fwd.head = bwd.head = 0;
+	fwd.tail = bwd.tail = 1;
+	fwd.queue[0] = prev[start] = start;
+	bwd.queue[0] = next[target] = target;
+	PATH_TRACE_BEGIN();
+	if (start == target)
+		meet = start;
+	while (meet == SIZE_MAX && fwd.head < fwd.tail && bwd.head < bwd.tail)
+	{
+		if (fwd.tail - fwd.head <= bwd.tail - bwd.head)
+			meet = expand_layer(&fwd, &bwd);
+		else
+			meet = expand_layer(&bwd, &fwd);
+	}
+	ok = meet != SIZE_MAX &&
+		bidirectional_join(prev, next, n, meet, target);
+	PATH_TRACE_END();
+	free(next);
+	free(queues);
+	return (ok);
+}
+
+/**
+ * bidirectional_bfs_csr - Finds a path with the fewest edges on a CSR
+ * snapshot, see bidirectional_bfs_run
+ * Servers answering many queries should build the transpose once with
+ * graph_csr_transpose, otherwise it is built for this query only
+ * @csr: Pointer to the snapshot
+ * @rev: Pointer to the transpose of @csr, or NULL
+ * @start: Index of the starting vertex
+ * @target: Index of the target vertex
+ *
+ * Return: Queue with the path, or NULL if there is none or on failure
+ */
+queue_t *bidirectional_bfs_csr(graph_csr_t const *csr, graph_csr_t const *rev,
+			       size_t start, size_t target)
+{
+	graph_csr_t *own = NULL;
+	size_t *prev;
+	queue_t *path = NULL;
+
+	if (!csr || start >= csr->nb_vertices || target >= csr->nb_vertices ||
+	    (rev && (rev->nb_vertices != csr->nb_vertices ||
+		     rev->nb_edges != csr->nb_edges)))
+		return (NULL);
+	if (!rev)
+		rev = own = graph_csr_transpose(csr);
+	prev = malloc(csr->nb_vertices * sizeof(*prev));
+	if (rev && prev && bidirectional_bfs_run(csr, rev, start, target, prev))
+		path = csr_build_path(csr, prev, start, target);
+	free(prev);
+	graph_csr_delete(own);
+	return (path);
+}
@@ -0,0 +1,140 @@
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include "pathfinding.h"
+
+/**
+ * grid_search_create - Allocates the state of the searches on a map size
+ * It takes 12 bytes per cell, allocated once and reused by every search
+ * @rows: Number of rows of the maps
+ * @cols: Number of columns of the maps
+ *
+ * Return: Pointer to the state, or NULL on failure or if the map has
+ * UINT32_MAX cells or more
+ */
+grid_search_t *grid_search_create(int rows, int cols)
+{
+	grid_search_t *search;
+	size_t n;
+
+	if (rows <= 0 || cols <= 0 ||
+	    (size_t)rows * (size_t)cols >= GRID_NONE)
+		return (NULL);
+	n = (size_t)rows * (size_t)cols;
+	search = calloc(1, sizeof(*search));
+	if (!search)
+		return (NULL);
+	search->rows = rows;
+	search->cols = cols;
+	search->g = malloc(n * sizeof(*search->g));
+	search->parent = malloc(n * sizeof(*search->parent));
+	search->stamp = calloc(n, sizeof(*search->stamp));
+	if (!search->g || !search->parent || !search->stamp)
+	{
+		grid_search_delete(search);
+		return (NULL);
+	}
+	return (search);
+}
+
+/**
+ * grid_search_delete - Frees the state of the searches on a map size
+ * @search: Pointer to the state
+ */
+void grid_search_delete(grid_search_t *search)
+{
+	if (!search)
+		return;
+	free(search->g);
+	free(search->parent);
+	free(search->stamp);
+	free(search->open);
+	free(search);
+}
+
+/**
+ * grid_search_reset - Starts a new search, forgetting every cell
+ * Stamps are only cleared when the search number wraps around
+ * @search: Pointer to the state
+ */
+void grid_search_reset(grid_search_t *search)
+{
+	search->nb_open = 0;
+	if (++search->gen < UINT32_MAX / 2)
+		return;
+	memset(search->stamp, 0, (size_t)search->rows * search->cols *
+	       sizeof(*search->stamp));
+	search->gen = 1;
+}
+
+/**
+ * grid_open_push - Adds a cell to the open list, with the cost in its g
+ * entry, a previous entry of the cell becoming stale
+ * @search: Pointer to the state
+ * @cell: Index of the cell
+ * @f: Estimated cost of the cheapest path through the cell
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int grid_open_push(grid_search_t *search, uint32_t cell, uint32_t f)
+{
+	grid_open_t *open, entry;
+	size_t at, parent;
+
+	if (search->nb_open == search->cap_open)
+	{
+		at = search->cap_open ? search->cap_open * 2 : 256;
+		open = realloc(search->open, at * sizeof(*open));
+		if (!open)
+			return (0);
+		search->open = open;
+		search->cap_open = at;
+	}
+	PATH_TRACE_COUNT(heap_ops, 1);
+	entry.key = (uint64_t)f << 32 | (uint32_t)~search->g[cell];
+	entry.cell = cell;
+	for (at = search->nb_open++; at > 0; at = parent)
+	{
+		parent = (at - 1) / 2;
+		if (search->open[parent].key <= entry.key)
+			break;
+		search->open[at] = search->open[parent];
+	}
+	search->open[at] = entry;
+	return (1);
+}
+
+/**
+ * grid_open_pop - Removes the open cell of smallest estimated cost
+ * Entries of closed cells, or whose cost was improved since they were
+ * pushed, are dropped on the way
+ * @search: Pointer to the state
+ *
+ * Return: Index of the cell, or GRID_NONE once the open list is empty
+ */
+uint32_t grid_open_pop(grid_search_t *search)
+{
+	grid_open_t top, last, *open = search->open;
+	size_t at, child;
+
+	while (search->nb_open)
+	{
+		PATH_TRACE_COUNT(heap_ops, 1);
+		top = open[0];
+		last = open[--search->nb_open];
+		for (at = 0; (child = at * 2 + 1) < search->nb_open; at = child)
+		{
+			if (child + 1 < search->nb_open &&
+			    open[child + 1].key < open[child].key)
+				child++;
+			if (last.key <= open[child].key)
+				break;
+			open[at] = open[child];
+		}
+		open[at] = last;
+		if (!GRID_CLOSED(search, top.cell) &&
+		    (uint32_t)top.key == (uint32_t)~search->g[top.cell])
+			return (top.cell);
+	}
+	return (GRID_NONE);
+}
@@ -0,0 +1,111 @@
+#include <stdlib.h>
+#include <stdint.h>
+#include "pathfinding.h"
+
+/**
+ * index_heap_init - Initializes an empty indexed min-heap
+ * @heap: Pointer to the heap to initialize
+ * @capacity: Number of distinct items (0 .. capacity - 1) it can hold
+ * @keys: Array of capacity keys the items are ordered by
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int index_heap_init(index_heap_t *heap, size_t capacity,
+		    const graph_dist_t *keys)
+{
+	size_t i;
+
+	heap->size = 0;
+	heap->keys = keys;
+	heap->items = malloc((capacity ? capacity : 1) * sizeof(*heap->items));
+	heap->pos = malloc((capacity ? capacity : 1) * sizeof(*heap->pos));
+	if (!heap->items || !heap->pos)
+	{
+		index_heap_free(heap);
+		return (0);
+	}
+	for (i = 0; i < capacity; i++)
+		heap->pos[i] = SIZE_MAX;
+	return (1);
+}
+
+/**
+ * index_heap_free - Frees the memory held by an indexed heap
+ * @heap: Pointer to the heap
+ */
+void index_heap_free(index_heap_t *heap)
+{
+	free(heap->items);
+	free(heap->pos);
+	heap->items = NULL;
+	heap->pos = NULL;
+	heap->size = 0;
+}
+
+/**
+ * heap_place - Stores an item at a given position of the heap
+ * @heap: Pointer to the heap
+ * @at: Position to store the item at
+ * @item: Item to store
+ */
+static void heap_place(index_heap_t *heap, size_t at, size_t item)
+{
+	heap->items[at] = item;
+	heap->pos[item] = at;
+}
+
+/**
+ * index_heap_update - Inserts an item, or moves it up after its key decreased
+ * @heap: Pointer to the heap
+ * @item: Item whose key is new or smaller than before
+ */
+void index_heap_update(index_heap_t *heap, size_t item)
+{
+	size_t at, parent;
+
+	PATH_TRACE_COUNT(heap_ops, 1);
+	at = heap->pos[item];
+	if (at == SIZE_MAX)
+		at = heap->size++;
+
+	while (at > 0)
+	{
+		parent = (at - 1) / 2;
+		if (heap->keys[heap->items[parent]] <= heap->keys[item])
+			break;
+		heap_place(heap, at, heap->items[parent]);
+		at = parent;
+	}
+	heap_place(heap, at, item);
+}
+
+/**
+ * index_heap_pop - Removes the item with the smallest key from the heap
+ * @heap: Pointer to the heap, must not be empty
+ *
+ * Return: The removed item
+ */
+size_t index_heap_pop(index_heap_t *heap)
+{
+	size_t top = heap->items[0], last, at = 0, child;
+
+	PATH_TRACE_COUNT(heap_ops, 1);
+	heap->pos[top] = SIZE_MAX;
+	last = heap->items[--heap->size];
+	if (!heap->size)
+		return (top);
+
+	while ((child = at * 2 + 1) < heap->size)
+	{
+		if (child + 1 < heap->size &&
+		    heap->keys[heap->items[child + 1]] <
+		    heap->keys[heap->items[child]])
+			child++;
+		if (heap->keys[last] <= heap->keys[heap->items[child]])
+			break;
+		heap_place(heap, at, heap->items[child]);
+		at = child;
+	}
+	heap_place(heap, at, last);
+	return (top);
+}
@@ -0,0 +1,104 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+#include "pathfinding.h"
+
+__thread path_trace_t *path_tracer;
+
+/**
+ * path_trace_set - Sets the tracing state of the searches of the calling
+ * thread
+ * Searches only report to it when the module is built with
+ * PATHFINDING_TRACE defined, otherwise the hooks compile to nothing and
+ * @trace is left untouched. To trace a single query, set it before the
+ * query and restore the previous state after it
+ * @trace: Pointer to the state, its depth set to 0, or NULL to stop tracing
+ *
+ * Return: Pointer to the previous state, or NULL
+ */
+path_trace_t *path_trace_set(path_trace_t *trace)
+{
+	path_trace_t *previous = path_tracer;
+
+	path_tracer = trace;
+	return (previous);
+}
+
+/**
+ * path_trace_begin - Notes the start of a search
+ * Only the outermost of nested searches is timed
+ */
+void path_trace_begin(void)
+{
+	struct timespec ts;
+
+	if (!path_tracer || path_tracer->depth++)
+		return;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	path_tracer->started = (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+/**
+ * path_trace_end - Notes the end of a search, adding its time to the
+ * counters
+ */
+void path_trace_end(void)
+{
+	struct timespec ts;
+
+	if (!path_tracer || !path_tracer->depth || --path_tracer->depth)
+		return;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	path_tracer->stats.elapsed_ns += (uint64_t)ts.tv_sec * 1000000000 +
+		ts.tv_nsec - path_tracer->started;
+}
+
+/**
+ * path_trace_expand - Counts an expanded cell or vertex and reports it to
+ * the hook, see path_step_t
+ * @name: Name of the vertex, or NULL for a cell
+ * @start: Name of the starting vertex of a distance search, or NULL
+ * @index: Index of the vertex or of the cell
+ * @x: X coordinate of the cell
+ * @y: Y coordinate of the cell
+ * @dist: Cost of the best known path from the start
+ */
+void path_trace_expand(const char *name, const char *start, size_t index,
+		       int x, int y, graph_dist_t dist)
+{
+	path_step_t step;
+
+	if (!path_tracer)
+		return;
+	path_tracer->stats.expanded++;
+	if (!path_tracer->hook)
+		return;
+	step.name = name;
+	step.start = start;
+	step.index = index;
+	step.x = x;
+	step.y = y;
+	step.dist = dist;
+	path_tracer->hook(path_tracer->data, &step);
+}
+
+/**
+ * path_trace_print - Trace hook printing every step to a stream, in the
+ * format the searches used to print unconditionally
+ * @data: FILE pointer to print to, or NULL for stdout
+ * @step: Pointer to the step
+ */
+void path_trace_print(void *data, const path_step_t *step)
+{
+	FILE *stream = data ? data : stdout;
+
+	if (!step->name)
+		fprintf(stream, "Checking coordinates [%d, %d]\n",
+			step->x, step->y);
+	else if (!step->start)
+		fprintf(stream, "Checking %s\n", step->name);
+	else
+		fprintf(stream, "Checking %s, distance from %s is "
+			GRAPH_DIST_FMT "\n", step->name, step->start,
+			GRAPH_DIST_ARG(step->dist));
+}
@@ -16,10 +16,217 @@ typedef struct point_s
 	int y;
 } point_t;
 
+/**
+ * struct index_heap_s - Binary min-heap of item indices supporting
+ * decrease-key, used to pick the next vertex to settle
+ * @size: Number of items in the heap
+ * @items: Array of items, in heap order
+ * @pos: Array mapping an item to its position in @items, or SIZE_MAX
+ * @keys: Array of keys the items are ordered by (owned by the caller)
+ */
+typedef struct index_heap_s
+{
+	size_t size;
+	size_t *items;
+	size_t *pos;
+	const graph_dist_t *keys;
+} index_heap_t;
+
+/**
+ * enum grid_moves_e - Moves allowed on a grid map
+ *
+ * @GRID_4: Right, bottom, left and top, guided by the Manhattan distance
+ * @GRID_8: Also diagonally, guided by the octile distance. A diagonal
+ *   move may not cut the corner of a blocked cell
+ */
+typedef enum grid_moves_e
+{
+	GRID_4 = 0,
+	GRID_8
+} grid_moves_t;
+
+/* Cost of a straight and of a diagonal step, about 1 and sqrt(2) */
+#define GRID_COST_STRAIGHT 10
+#define GRID_COST_DIAGONAL 14
+#define GRID_NONE UINT32_MAX
+
+/**
+ * struct grid_open_s - Entry of the open list of a grid search
+ * @key: Estimated total cost in the upper 32 bits, then the complement of
+ * the cost so far, so ties go to the cell closest to the target
+ * @cell: Index of the cell, y * cols + x
+ */
+typedef struct grid_open_s
+{
+	uint64_t key;
+	uint32_t cell;
+} grid_open_t;
+
+/**
+ * struct grid_search_s - Reusable state of the searches on one map size
+ * Cells are only valid for the current search when their stamp says so,
+ * so starting a search costs nothing however large the map is
+ * @rows: Number of rows of the map
+ * @cols: Number of columns of the map
+ * @g: Array of the cost of the best known path to each cell
+ * @parent: Array of the cell each cell was reached from
+ * @stamp: Array of 2 * @gen for cells opened by the current search,
+ * 2 * @gen + 1 once closed, and anything lower otherwise
+ * @gen: Number of the current search
+ * @open: Binary min-heap of open cells, stale entries are skipped lazily
+ * @nb_open: Number of entries in @open
+ * @cap_open: Number of entries @open has room for
+ */
+typedef struct grid_search_s
+{
+	int rows;
+	int cols;
+	uint32_t *g;
+	uint32_t *parent;
+	uint32_t *stamp;
+	uint32_t gen;
+	grid_open_t *open;
+	size_t nb_open;
+	size_t cap_open;
+} grid_search_t;
+
+#define GRID_OPENED(s, c) ((s)->stamp[c] >= 2 * (s)->gen)
+#define GRID_CLOSED(s, c) ((s)->stamp[c] == 2 * (s)->gen + 1)
+#define GRID_FREE(map, s, x, y) ((x) >= 0 && (x) < (s)->cols && (y) >= 0 && \
+				 (y) < (s)->rows && (map)[y][x] == '0')
+
+/**
+ * struct path_step_s - Cell or vertex expanded by a search, as reported to
+ * a trace hook
+ * @name: Name of the vertex, or NULL for a cell of a grid map
+ * @start: Name of the starting vertex of a distance search, NULL otherwise
+ * @index: Index of the vertex, or of the cell, y * cols + x
+ * @x: X coordinate of the cell, 0 for a vertex
+ * @y: Y coordinate of the cell, 0 for a vertex
+ * @dist: Cost of the best known path from the start, 0 if the search has
+ * no costs
+ */
+typedef struct path_step_s
+{
+	const char *name;
+	const char *start;
+	size_t index;
+	int x;
+	int y;
+	graph_dist_t dist;
+} path_step_t;
+
+/**
+ * struct path_stats_s - Counters aggregated over the searches of a trace
+ * @expanded: Number of cells or vertices expanded
+ * @relaxed: Number of edges, or moves to a neighbouring cell, examined
+ * @heap_ops: Number of insertions, decreases and removals on a heap
+ * @elapsed_ns: Time spent in the searches, in nanoseconds
+ */
+typedef struct path_stats_s
+{
+	uint64_t expanded;
+	uint64_t relaxed;
+	uint64_t heap_ops;
+	uint64_t elapsed_ns;
+} path_stats_t;
+
+/**
+ * struct path_trace_s - Tracing state of the searches of a thread
+ * Only built in when PATHFINDING_TRACE is defined, see path_trace_set
+ * @hook: Function called on every expanded cell or vertex, or NULL to only
+ * count them
+ * @data: Argument passed to @hook
+ * @stats: Counters, added to by every search until the caller clears them
+ * @depth: Number of searches running, as searches may call one another
+ * @started: Time the outermost running search started, in nanoseconds
+ */
+typedef struct path_trace_s
+{
+	void (*hook)(void *data, const path_step_t *step);
+	void *data;
+	path_stats_t stats;
+	unsigned int depth;
+	uint64_t started;
+} path_trace_t;
+
+extern __thread path_trace_t *path_tracer;
+
+#ifdef PATHFINDING_TRACE
+#define PATH_TRACE_BEGIN() path_trace_begin()
+#define PATH_TRACE_END() path_trace_end()
+#define PATH_TRACE_EXPAND(name, start, index, x, y, dist) \
+	path_trace_expand(name, start, index, x, y, dist)
+#define PATH_TRACE_COUNT(counter, n) \
+	((void)(path_tracer && (path_tracer->stats.counter += (n))))
+#else
+#define PATH_TRACE_BEGIN() ((void)0)
+#define PATH_TRACE_END() ((void)0)
+#define PATH_TRACE_EXPAND(name, start, index, x, y, dist) ((void)0)
+#define PATH_TRACE_COUNT(counter, n) ((void)0)
+#endif
+
 queue_t *backtracking_array(char **map, int rows, int cols,
 			    point_t const *start, point_t const *target);
 queue_t *backtracking_graph(graph_t *graph,
 			    vertex_t const *start, vertex_t const *target);
 queue_t *dijkstra_graph(graph_t *graph,
 			vertex_t const *start, vertex_t const *target);
+queue_t *dijkstra_csr(graph_csr_t const *csr, size_t start, size_t target);
+queue_t *dag_shortest_path_csr(graph_csr_t const *csr, size_t start,
+			       size_t target);
+queue_t *bidirectional_dijkstra_csr(graph_csr_t const *csr,
+				    graph_csr_t const *rev, size_t start,
+				    size_t target);
+queue_t *bidirectional_bfs_csr(graph_csr_t const *csr, graph_csr_t const *rev,
+			       size_t start, size_t target);
+vertex_id_t *backtracking_graph_id(graph_t *graph, vertex_id_t start,
+				   vertex_id_t target, size_t *length);
+vertex_id_t *dijkstra_graph_id(graph_t *graph, vertex_id_t start,
+			       vertex_id_t target, size_t *length);
+
+queue_t *astar_array(char **map, int rows, int cols, point_t const *start,
+		     point_t const *target, grid_moves_t moves);
+queue_t *jps_array(char **map, int rows, int cols, point_t const *start,
+		   point_t const *target);
+queue_t *astar_grid(grid_search_t *search, char **map, point_t const *start,
+		    point_t const *target, grid_moves_t moves);
+queue_t *jps_grid(grid_search_t *search, char **map, point_t const *start,
+		  point_t const *target);
+grid_search_t *grid_search_create(int rows, int cols);
+void grid_search_delete(grid_search_t *search);
+
+path_trace_t *path_trace_set(path_trace_t *trace);
+void path_trace_print(void *data, const path_step_t *step);
+
+int dijkstra_graph_run(graph_t const *graph, size_t start, size_t target,
+		       size_t *prev);
+int dijkstra_csr_run(graph_csr_t const *csr, size_t start, size_t target,
+		     size_t *prev);
+int dag_csr_run(graph_csr_t const *csr, const size_t *order, size_t start,
+		size_t target, size_t *prev);
+int bidirectional_dijkstra_run(graph_csr_t const *csr, graph_csr_t const *rev,
+			       size_t start, size_t target, size_t *prev);
+int bidirectional_bfs_run(graph_csr_t const *csr, graph_csr_t const *rev,
+			  size_t start, size_t target, size_t *prev);
+queue_t *csr_build_path(graph_csr_t const *csr, const size_t *prev,
+			size_t start, size_t target);
+int bidirectional_join(size_t *prev, const size_t *next, size_t nb_vertices,
+		       size_t meet, size_t target);
+
+int index_heap_init(index_heap_t *heap, size_t capacity,
+		    const graph_dist_t *keys);
+void index_heap_free(index_heap_t *heap);
+void index_heap_update(index_heap_t *heap, size_t item);
+size_t index_heap_pop(index_heap_t *heap);
+void grid_search_reset(grid_search_t *search);
+int grid_open_push(grid_search_t *search, uint32_t cell, uint32_t f);
+uint32_t grid_open_pop(grid_search_t *search);
+uint32_t grid_heuristic(int x, int y, point_t const *target,
+			grid_moves_t moves);
+queue_t *grid_build_path(const grid_search_t *search, uint32_t cell);
+void path_trace_begin(void);
+void path_trace_end(void);
+void path_trace_expand(const char *name, const char *start, size_t index,
+		       int x, int y, graph_dist_t dist);
 #endif /* PATHFINDING_H */